@@ -3,6 +3,7 @@
 
 #include "AmmoPickup.h"
 
+#include "ShooterArenaSubsystem.h"
 #include "ShooterCharacter.h"
 #include "ShooterWeapon.h"
 
@@ -80,3 +81,17 @@ void AAmmoPickup::NotifyActorBeginOverlap(AActor* OtherActor)
 
 	
 }
+
+bool AAmmoPickup::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	// players in other arenas never see this pickup
+	if (const UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		if (!Arenas->IsRelevantInArena(this, RealViewer, ViewTarget))
+		{
+			return false;
+		}
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
@@ -32,6 +32,9 @@ protected:
 
 	virtual void NotifyActorBeginOverlap(AActor* OtherActor) override;
 
+	// Hides the pickup from players in other arenas
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
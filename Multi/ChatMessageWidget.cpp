@@ -1,5 +0,0 @@
-// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
-
-
-#include "ChatMessageWidget.h"
-
@@ -14,14 +14,14 @@ public class Multi : ModuleRules
 			"Engine",
 			"InputCore",
 			"EnhancedInput",
+			"NetCore",
 			"AIModule",
 			"StateTreeModule",
-			"GameplayStateTreeModule",
-			"UMG",
-			"Slate"
+			"GameplayStateTreeModule"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		// Slate is only used to check for the touch interface when picking input mapping contexts
+		PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 
 		PublicIncludePaths.AddRange(new string[] {
 			"Multi",
@@ -29,12 +29,10 @@ public class Multi : ModuleRules
 			"Multi/Variant_Horror/UI",
 			"Multi/Variant_Shooter",
 			"Multi/Variant_Shooter/AI",
-			"Multi/Variant_Shooter/UI",
 			"Multi/Variant_Shooter/Weapons"
 		});
 
-		// Uncomment if you are using Slate UI
-		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
+		// Widgets live in the ClientOnly MultiClient module, so dedicated servers don't link UMG or load any widget classes
 
 		// Uncomment if you are using online features
 		// PrivateDependencyModuleNames.Add("OnlineSubsystem");
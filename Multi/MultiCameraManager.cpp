@@ -2,10 +2,174 @@
 
 
 #include "MultiCameraManager.h"
+#include "ShooterRecoilCameraModifier.h"
+#include "ShooterClockSyncComponent.h"
+#include "ShooterPlayerController.h"
+#include "ShooterWeapon.h"
+#include "Engine/World.h"
 
 AMultiCameraManager::AMultiCameraManager()
 {
 	// set the min/max pitch
 	ViewPitchMin = -70.0f;
 	ViewPitchMax = 80.0f;
+
+	// set the recoil modifier class
+	RecoilModifierClass = UShooterRecoilCameraModifier::StaticClass();
+}
+
+void AMultiCameraManager::StartPredictedRecoil(const AShooterWeapon* Weapon)
+{
+	if (!Weapon)
+	{
+		return;
+	}
+
+	// a new weapon or a long pause restarts the pattern
+	if (RecoilWeapon.Get() != Weapon || GetWorld()->GetTimeSeconds() - LastKickTime > Weapon->GetRefireRate() * 2.0f)
+	{
+		PatternIndex = 0;
+	}
+
+	RecoilWeapon = Weapon;
+	bPredictingFire = true;
+
+	TryPredictShot();
+}
+
+void AMultiCameraManager::StopPredictedRecoil()
+{
+	bPredictingFire = false;
+}
+
+void AMultiCameraManager::ConfirmRecoilShot(const AShooterWeapon* Weapon)
+{
+	// a predicted kick for this shot was already applied
+	if (UnconfirmedKicks.Num() > 0)
+	{
+		UnconfirmedKicks.RemoveAt(0);
+		return;
+	}
+
+	// the server fired a shot we didn't predict, apply it late
+	if (Weapon)
+	{
+		ApplyKick(GetPatternKick(Weapon, PatternIndex++));
+		LastKickTime = GetWorld()->GetTimeSeconds();
+	}
+}
+
+void AMultiCameraManager::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	if (RecoilModifierClass)
+	{
+		RecoilModifier = Cast<UShooterRecoilCameraModifier>(AddNewCameraModifier(RecoilModifierClass));
+	}
+}
+
+void AMultiCameraManager::UpdateCamera(float DeltaTime)
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	// keep predicting full auto shots while the trigger is held
+	if (bPredictingFire)
+	{
+		const AShooterWeapon* Weapon = RecoilWeapon.Get();
+
+		if (Weapon && Weapon->IsFullAuto())
+		{
+			TryPredictShot();
+		}
+	}
+
+	// undo predicted kicks the server never confirmed
+	const float Timeout = GetConfirmationTimeout();
+
+	while (UnconfirmedKicks.Num() > 0 && Now - UnconfirmedKicks[0].Time > Timeout)
+	{
+		const FRotator Kick = UnconfirmedKicks[0].Kick;
+		UnconfirmedKicks.RemoveAt(0);
+
+		ApplyKick(Kick.GetInverse());
+		PatternIndex = FMath::Max(0, PatternIndex - 1);
+	}
+
+	Super::UpdateCamera(DeltaTime);
+}
+
+void AMultiCameraManager::TryPredictShot()
+{
+	const AShooterWeapon* Weapon = RecoilWeapon.Get();
+	if (!Weapon)
+	{
+		return;
+	}
+
+	// mirror the server refire and ammo checks
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	if (Now - LastKickTime < Weapon->GetRefireRate())
+	{
+		return;
+	}
+
+	if (Weapon->GetBulletCount() - UnconfirmedKicks.Num() <= 0)
+	{
+		return;
+	}
+
+	const FRotator Kick = GetPatternKick(Weapon, PatternIndex++);
+	ApplyKick(Kick);
+	LastKickTime = Now;
+
+	FPredictedKick& Predicted = UnconfirmedKicks.AddDefaulted_GetRef();
+	Predicted.Kick = Kick;
+	Predicted.Time = Now;
+}
+
+FRotator AMultiCameraManager::GetPatternKick(const AShooterWeapon* Weapon, int32 ShotIndex) const
+{
+	const float Recoil = Weapon->GetFiringRecoil();
+
+	// vertical recoil climbs over the first shots of a burst
+	const float Pitch = Recoil * (1.0f + RecoilClimbPerShot * FMath::Min(ShotIndex, RecoilClimbShots));
+
+	// horizontal recoil is deterministic for the weapon and shot index
+	const FRandomStream Stream(HashCombine(Weapon->GetRecoilSeed(), GetTypeHash(ShotIndex)));
+	const float Yaw = Recoil * RecoilYawScale * Stream.FRandRange(-1.0f, 1.0f);
+
+	return FRotator(Pitch, Yaw, 0.0f);
+}
+
+void AMultiCameraManager::ApplyKick(const FRotator& Kick)
+{
+	// change the aim. Control rotation reaches the server with the regular movement updates
+	if (PCOwner)
+	{
+		PCOwner->AddPitchInput(Kick.Pitch);
+		PCOwner->AddYawInput(Kick.Yaw);
+	}
+
+	// add the visual punch
+	if (RecoilModifier)
+	{
+		RecoilModifier->AddPunch(Kick);
+	}
+}
+
+float AMultiCameraManager::GetConfirmationTimeout() const
+{
+	float RoundTrip = 0.0f;
+
+	if (const AShooterPlayerController* PC = Cast<AShooterPlayerController>(PCOwner))
+	{
+		if (PC->GetClockSync())
+		{
+			RoundTrip = PC->GetClockSync()->GetRoundTripTime();
+		}
+	}
+
+	return RoundTrip + ConfirmationGrace;
 }
@@ -6,17 +6,98 @@
 #include "Camera/PlayerCameraManager.h"
 #include "MultiCameraManager.generated.h"
 
+class AShooterWeapon;
+class UShooterRecoilCameraModifier;
+
 /**
  *  Basic First Person camera manager.
  *  Limits min/max look pitch.
+ *  Predicts weapon recoil locally from the fire input and reconciles it with server shot confirmations.
  */
 UCLASS()
 class AMultiCameraManager : public APlayerCameraManager
 {
 	GENERATED_BODY()
-	
+
 public:
 
 	/** Constructor */
 	AMultiCameraManager();
+
+	/** Starts predicting recoil for the given weapon from local fire input */
+	void StartPredictedRecoil(const AShooterWeapon* Weapon);
+
+	/** Stops predicting recoil when the local fire input is released */
+	void StopPredictedRecoil();
+
+	/** Called when the server confirms a shot from the local player's weapon */
+	void ConfirmRecoilShot(const AShooterWeapon* Weapon);
+
+protected:
+
+	/** Horizontal recoil range, as a fraction of the weapon's vertical recoil */
+	UPROPERTY(EditAnywhere, Category="Recoil", meta = (ClampMin = 0, ClampMax = 2))
+	float RecoilYawScale = 0.35f;
+
+	/** Extra vertical recoil added per consecutive shot, as a fraction of the weapon's recoil */
+	UPROPERTY(EditAnywhere, Category="Recoil", meta = (ClampMin = 0, ClampMax = 1))
+	float RecoilClimbPerShot = 0.1f;
+
+	/** Number of consecutive shots after which the recoil stops climbing */
+	UPROPERTY(EditAnywhere, Category="Recoil", meta = (ClampMin = 0, ClampMax = 30))
+	int32 RecoilClimbShots = 5;
+
+	/** Extra time on top of the round trip to wait for a shot confirmation before undoing its kick */
+	UPROPERTY(EditAnywhere, Category="Recoil", meta = (ClampMin = 0, ClampMax = 2, Units = "s"))
+	float ConfirmationGrace = 0.15f;
+
+	/** Camera modifier class used for the visual recoil punch */
+	UPROPERTY(EditAnywhere, Category="Recoil")
+	TSubclassOf<UShooterRecoilCameraModifier> RecoilModifierClass;
+
+	/** Creates the recoil modifier */
+	virtual void PostInitializeComponents() override;
+
+	/** Drives predicted full auto recoil and reconciliation */
+	virtual void UpdateCamera(float DeltaTime) override;
+
+private:
+
+	/** A predicted kick waiting for server confirmation */
+	struct FPredictedKick
+	{
+		FRotator Kick;
+		float Time = 0.0f;
+	};
+
+	/** Weapon recoil is being predicted for */
+	TWeakObjectPtr<const AShooterWeapon> RecoilWeapon;
+
+	/** Recoil modifier instance */
+	UPROPERTY()
+	TObjectPtr<UShooterRecoilCameraModifier> RecoilModifier;
+
+	/** Predicted kicks not yet confirmed by the server, oldest first */
+	TArray<FPredictedKick> UnconfirmedKicks;
+
+	/** True while the local fire input is held */
+	bool bPredictingFire = false;
+
+	/** Time of the last kick, predicted or confirmed */
+	float LastKickTime = -UE_BIG_NUMBER;
+
+	/** Index of the current shot in the recoil pattern */
+	int32 PatternIndex = 0;
+
+	/** Applies a predicted kick if the weapon is ready and has ammo */
+	void TryPredictShot();
+
+	/** Returns the deterministic kick for the given shot of the weapon's pattern */
+	FRotator GetPatternKick(const AShooterWeapon* Weapon, int32 ShotIndex) const;
+
+	/** Applies a kick to the aim and the view */
+	void ApplyKick(const FRotator& Kick);
+
+	/** Returns the time to wait for a confirmation before undoing a predicted kick */
+	float GetConfirmationTimeout() const;
 };
@@ -7,10 +7,11 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "EnhancedInputComponent.h"
 #include "InputActionValue.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "ShooterCharacterMovementComponent.h"
 #include "Multi.h"
 
-AMultiCharacter::AMultiCharacter()
+AMultiCharacter::AMultiCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UShooterCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(55.f, 96.0f);
@@ -39,9 +40,7 @@ AMultiCharacter::AMultiCharacter()
 
 	GetCapsuleComponent()->SetCapsuleSize(34.0f, 96.0f);
 
-	// Configure character movement
-	GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
-	GetCharacterMovement()->AirControl = 0.5f;
+	// character movement is configured by UShooterCharacterMovementComponent
 }
 
 void AMultiCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -56,6 +55,14 @@ void AMultiCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComp
 		// Moving
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &AMultiCharacter::MoveInput);
 
+		// Sprinting
+		EnhancedInputComponent->BindAction(SprintAction, ETriggerEvent::Started, this, &AMultiCharacter::DoSprintStart);
+		EnhancedInputComponent->BindAction(SprintAction, ETriggerEvent::Completed, this, &AMultiCharacter::DoSprintEnd);
+
+		// Crouching
+		EnhancedInputComponent->BindAction(CrouchAction, ETriggerEvent::Started, this, &AMultiCharacter::DoCrouchStart);
+		EnhancedInputComponent->BindAction(CrouchAction, ETriggerEvent::Completed, this, &AMultiCharacter::DoCrouchEnd);
+
 		// Looking/Aiming
 		EnhancedInputComponent->BindAction(LookAction, ETriggerEvent::Triggered, this, &AMultiCharacter::LookInput);
 		EnhancedInputComponent->BindAction(MouseLookAction, ETriggerEvent::Triggered, this, &AMultiCharacter::LookInput);
@@ -118,3 +125,31 @@ void AMultiCharacter::DoJumpEnd()
 	// pass StopJumping to the character
 	StopJumping();
 }
+
+void AMultiCharacter::DoSprintStart()
+{
+	// sprint is sent to the server as a predicted move flag
+	GetShooterCharacterMovement()->SetSprinting(true);
+}
+
+void AMultiCharacter::DoSprintEnd()
+{
+	GetShooterCharacterMovement()->SetSprinting(false);
+}
+
+void AMultiCharacter::DoCrouchStart()
+{
+	// pass Crouch to the character. Crouch is also a predicted move flag
+	Crouch();
+}
+
+void AMultiCharacter::DoCrouchEnd()
+{
+	// pass UnCrouch to the character
+	UnCrouch();
+}
+
+UShooterCharacterMovementComponent* AMultiCharacter::GetShooterCharacterMovement() const
+{
+	return CastChecked<UShooterCharacterMovementComponent>(GetCharacterMovement());
+}
@@ -70,6 +70,8 @@ void UMultiOnlineSubsystem::HostSession()
 	{
 		if (Result.IsOk())
 		{
+			// Going from standalone to a listen server needs a hard travel.
+			// Map changes after this are seamless, see AShooterGameMode
 			GetWorld()->ServerTravel("Lvl_Shooter?listen");
 		}
 		else
@@ -4,10 +4,9 @@
 #include "MultiPlayerController.h"
 #include "EnhancedInputSubsystems.h"
 #include "Engine/LocalPlayer.h"
+#include "GameFramework/HUD.h"
 #include "InputMappingContext.h"
 #include "MultiCameraManager.h"
-#include "Blueprint/UserWidget.h"
-#include "Multi.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
 AMultiPlayerController::AMultiPlayerController()
@@ -16,31 +15,6 @@ AMultiPlayerController::AMultiPlayerController()
 	PlayerCameraManagerClass = AMultiCameraManager::StaticClass();
 }
 
-void AMultiPlayerController::BeginPlay()
-{
-	Super::BeginPlay();
-
-	
-	// only spawn touch controls on local player controllers
-	if (SVirtualJoystick::ShouldDisplayTouchInterface() && IsLocalPlayerController())
-	{
-		// spawn the mobile controls widget
-		MobileControlsWidget = CreateWidget<UUserWidget>(this, MobileControlsWidgetClass);
-
-		if (MobileControlsWidget)
-		{
-			// add the controls to the player screen
-			MobileControlsWidget->AddToPlayerScreen(0);
-
-		} else {
-
-			UE_LOG(LogMulti, Error, TEXT("Could not spawn mobile controls widget."));
-
-		}
-
-	}
-}
-
 void AMultiPlayerController::SetupInputComponent()
 {
 	Super::SetupInputComponent();
@@ -68,3 +42,14 @@ void AMultiPlayerController::SetupInputComponent()
 	}
 	
 }
+
+void AMultiPlayerController::ClientSetHUD_Implementation(TSubclassOf<AHUD> NewHUDClass)
+{
+	// the server can't load client module classes, so the HUD is resolved here
+	if (UClass* LoadedHUDClass = ClientHUDClass.LoadSynchronous())
+	{
+		NewHUDClass = LoadedHUDClass;
+	}
+
+	Super::ClientSetHUD_Implementation(NewHUDClass);
+}
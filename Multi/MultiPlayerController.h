@@ -7,14 +7,15 @@
 #include "MultiPlayerController.generated.h"
 
 class UInputMappingContext;
-class UUserWidget;
+class AHUD;
 
 /**
  *  Simple first person Player Controller
  *  Manages the input mapping context.
  *  Overrides the Player Camera Manager class.
+ *  Picks its HUD on the client, since dedicated servers don't load the client module.
  */
-UCLASS(abstract)
+UCLASS(abstract, Config=Game)
 class MULTI_API AMultiPlayerController : public APlayerController
 {
 	GENERATED_BODY()
@@ -34,17 +35,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Input|Input Mappings")
 	TArray<UInputMappingContext*> MobileExcludedMappingContexts;
 
-	/** Mobile controls widget to spawn */
-	UPROPERTY(EditAnywhere, Category="Input|Touch Controls")
-	TSubclassOf<UUserWidget> MobileControlsWidgetClass;
-
-	/** Pointer to the mobile controls widget */
-	TObjectPtr<UUserWidget> MobileControlsWidget;
-
-	/** Gameplay initialization */
-	virtual void BeginPlay() override;
+	/** HUD to use on this client. Set in config so the server never has to resolve a MultiClient class */
+	UPROPERTY(Config, EditDefaultsOnly, Category="HUD")
+	TSoftClassPtr<AHUD> ClientHUDClass;
 
 	/** Input mapping context setup */
 	virtual void SetupInputComponent() override;
 
+	/** Uses the client HUD class over the one sent by the server */
+	virtual void ClientSetHUD_Implementation(TSubclassOf<AHUD> NewHUDClass) override;
+
 };
@@ -0,0 +1,168 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterAlerts.h"
+#include "ShooterPlayerState.h"
+#include "GameFramework/GameStateBase.h"
+
+bool FShooterAlert::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 TypeByte = static_cast<uint8>(Type);
+	uint8 ColorByte = static_cast<uint8>(Color);
+
+	bool bHasPlayer = Player != INDEX_NONE;
+	bool bHasOtherPlayer = OtherPlayer != INDEX_NONE;
+	bool bHasCount = Count != 0;
+	bool bHasArena = ArenaIndex != INDEX_NONE;
+
+	Ar.SerializeBits(&TypeByte, 4);
+	Ar.SerializeBits(&ColorByte, 2);
+	Ar.SerializeBits(&bHasPlayer, 1);
+	Ar.SerializeBits(&bHasOtherPlayer, 1);
+	Ar.SerializeBits(&bHasCount, 1);
+	Ar.SerializeBits(&bHasArena, 1);
+
+	// player IDs and arena indices are small, so they pack to a byte or two
+	uint32 PlayerValue = bHasPlayer ? static_cast<uint32>(Player) : 0;
+	uint32 OtherPlayerValue = bHasOtherPlayer ? static_cast<uint32>(OtherPlayer) : 0;
+	uint32 ArenaValue = bHasArena ? static_cast<uint32>(ArenaIndex) : 0;
+
+	if (bHasPlayer)
+	{
+		Ar.SerializeIntPacked(PlayerValue);
+	}
+
+	if (bHasOtherPlayer)
+	{
+		Ar.SerializeIntPacked(OtherPlayerValue);
+	}
+
+	if (bHasCount)
+	{
+		Ar << Count;
+	}
+
+	if (bHasArena)
+	{
+		Ar.SerializeIntPacked(ArenaValue);
+	}
+
+	if (Ar.IsLoading())
+	{
+		Type = static_cast<EShooterAlert>(TypeByte);
+		Color = static_cast<EShooterAlertColor>(ColorByte);
+		Player = bHasPlayer ? static_cast<int32>(PlayerValue) : INDEX_NONE;
+		OtherPlayer = bHasOtherPlayer ? static_cast<int32>(OtherPlayerValue) : INDEX_NONE;
+		Count = bHasCount ? Count : 0;
+		ArenaIndex = bHasArena ? static_cast<int32>(ArenaValue) : INDEX_NONE;
+	}
+
+	bOutSuccess = true;
+	return true;
+}
+
+namespace ShooterAlerts
+{
+	/** Finds a player state by player ID */
+	static const AShooterPlayerState* FindPlayer(const AGameStateBase* GameState, int32 PlayerId)
+	{
+		if (GameState && PlayerId != INDEX_NONE)
+		{
+			for (const APlayerState* PlayerState : GameState->PlayerArray)
+			{
+				if (PlayerState && PlayerState->GetPlayerId() == PlayerId)
+				{
+					return Cast<AShooterPlayerState>(PlayerState);
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** Returns the player's name, or a placeholder if they already left */
+	static FString GetPlayerName(const AShooterPlayerState* PlayerState)
+	{
+		return PlayerState ? PlayerState->GetPlayerName() : FString(TEXT("Someone"));
+	}
+
+	uint8 GetPriority(EShooterAlert Type)
+	{
+		switch (Type)
+		{
+		case EShooterAlert::RedTeamWins:
+		case EShooterAlert::BlueTeamWins:
+			return 3;
+		case EShooterAlert::MatchStarting:
+			return 2;
+		case EShooterAlert::StreakEnded:
+			return 1;
+		default:
+			return 0;
+		}
+	}
+
+	float GetDuration(EShooterAlert Type)
+	{
+		switch (Type)
+		{
+		case EShooterAlert::RedTeamWins:
+		case EShooterAlert::BlueTeamWins:
+			return 5.0f;
+		case EShooterAlert::MatchStarting:
+			return 3.0f;
+		default:
+			return 2.5f;
+		}
+	}
+
+	FLinearColor GetColor(EShooterAlertColor Color)
+	{
+		switch (Color)
+		{
+		case EShooterAlertColor::Red:
+			return FLinearColor::Red;
+		case EShooterAlertColor::Blue:
+			return FLinearColor::Blue;
+		case EShooterAlertColor::Green:
+			return FLinearColor::Green;
+		default:
+			return FLinearColor::White;
+		}
+	}
+
+	FString FormatAlert(const FShooterAlert& Alert, const AGameStateBase* GameState)
+	{
+		switch (Alert.Type)
+		{
+		case EShooterAlert::MatchStarting:
+			return TEXT("STARTING MATCH");
+
+		case EShooterAlert::RedTeamWins:
+			return TEXT("RED TEAM WINS");
+
+		case EShooterAlert::BlueTeamWins:
+			return TEXT("BLUE TEAM WINS");
+
+		case EShooterAlert::KillStreak:
+		{
+			const AShooterPlayerState* PlayerState = FindPlayer(GameState, Alert.Player);
+
+			// the streak messages are configured on the player state
+			const FString* Message = PlayerState ? PlayerState->KillstreakMessages.Find(Alert.Count) : nullptr;
+			if (!Message)
+			{
+				return FString::Printf(TEXT("%s is on a %d kill streak!"), *GetPlayerName(PlayerState), Alert.Count);
+			}
+
+			return FString::Printf(TEXT("%s %s"), *GetPlayerName(PlayerState), **Message);
+		}
+
+		case EShooterAlert::StreakEnded:
+			return FString::Printf(TEXT("%s ended %s's streak!"),
+				*GetPlayerName(FindPlayer(GameState, Alert.Player)), *GetPlayerName(FindPlayer(GameState, Alert.OtherPlayer)));
+		}
+
+		return FString();
+	}
+}
@@ -0,0 +1,101 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ShooterAlerts.generated.h"
+
+class AGameStateBase;
+
+/**
+ *  Alerts the server can raise. Clients build the text locally from the type and payload
+ */
+UENUM()
+enum class EShooterAlert : uint8
+{
+	/* The pre-match countdown finished */
+	MatchStarting,
+	/* Red team reached the score limit */
+	RedTeamWins,
+	/* Blue team reached the score limit */
+	BlueTeamWins,
+	/* A player reached a kill streak threshold. Uses Player and Count */
+	KillStreak,
+	/* A player ended another player's streak. Uses Player and OtherPlayer */
+	StreakEnded
+};
+
+/**
+ *  Alert color, sent as an index instead of a full color
+ */
+UENUM()
+enum class EShooterAlertColor : uint8
+{
+	White,
+	Red,
+	Blue,
+	Green
+};
+
+/**
+ *  Compact alert sent from the server. Serializes to a few bytes
+ */
+USTRUCT()
+struct MULTI_API FShooterAlert
+{
+	GENERATED_BODY()
+
+	/** Alert type */
+	UPROPERTY()
+	EShooterAlert Type = EShooterAlert::MatchStarting;
+
+	/** Alert color */
+	UPROPERTY()
+	EShooterAlertColor Color = EShooterAlertColor::White;
+
+	/** Main player, by player ID */
+	UPROPERTY()
+	int32 Player = INDEX_NONE;
+
+	/** Second player, by player ID */
+	UPROPERTY()
+	int32 OtherPlayer = INDEX_NONE;
+
+	/** Type specific count, like a kill streak */
+	UPROPERTY()
+	uint8 Count = 0;
+
+	/** Arena the alert is shown in, or INDEX_NONE for everyone */
+	UPROPERTY()
+	int32 ArenaIndex = INDEX_NONE;
+
+	/** Packs the alert into a type nibble, a color and presence bits, followed by only the payload it uses */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FShooterAlert> : public TStructOpsTypeTraitsBase2<FShooterAlert>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ *  Client side catalog that turns alerts into text, colors and durations
+ */
+namespace ShooterAlerts
+{
+	/** Returns the priority of the alert type. Higher priority alerts win when several arrive together */
+	MULTI_API uint8 GetPriority(EShooterAlert Type);
+
+	/** Returns how long the alert type stays on screen */
+	MULTI_API float GetDuration(EShooterAlert Type);
+
+	/** Returns the display color */
+	MULTI_API FLinearColor GetColor(EShooterAlertColor Color);
+
+	/** Builds the alert text, looking players up in the game state */
+	MULTI_API FString FormatAlert(const FShooterAlert& Alert, const AGameStateBase* GameState);
+}
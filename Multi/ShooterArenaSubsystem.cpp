@@ -0,0 +1,145 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterArenaSubsystem.h"
+#include "ShooterArena.h"
+#include "ShooterPlayerState.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+
+void UShooterArenaSubsystem::RegisterArena(AShooterArena* Arena)
+{
+	Arenas.AddUnique(Arena);
+
+	// clients get the index through replication
+	if (Arena->HasAuthority())
+	{
+		Arena->ArenaIndex = NextArenaIndex++;
+	}
+}
+
+void UShooterArenaSubsystem::UnregisterArena(AShooterArena* Arena)
+{
+	Arenas.Remove(Arena);
+}
+
+AShooterArena* UShooterArenaSubsystem::AssignPlayer(AShooterPlayerState* PlayerState)
+{
+	AShooterArena* BestArena = nullptr;
+
+	for (AShooterArena* Arena : Arenas)
+	{
+		if (Arena->HasRoom() && (!BestArena || Arena->GetNumPlayers() < BestArena->GetNumPlayers()))
+		{
+			BestArena = Arena;
+		}
+	}
+
+	if (BestArena)
+	{
+		BestArena->AddPlayer(PlayerState);
+	}
+
+	return BestArena;
+}
+
+void UShooterArenaSubsystem::ReleasePlayer(AShooterPlayerState* PlayerState)
+{
+	if (AShooterArena* Arena = GetArena(PlayerState->ArenaIndex))
+	{
+		Arena->RemovePlayer(PlayerState);
+	}
+}
+
+AShooterArena* UShooterArenaSubsystem::GetArena(int32 ArenaIndex) const
+{
+	if (ArenaIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	for (AShooterArena* Arena : Arenas)
+	{
+		if (Arena->ArenaIndex == ArenaIndex)
+		{
+			return Arena;
+		}
+	}
+
+	return nullptr;
+}
+
+AShooterArena* UShooterArenaSubsystem::GetArenaAt(const FVector& Location) const
+{
+	for (AShooterArena* Arena : Arenas)
+	{
+		if (Arena->ContainsLocation(Location))
+		{
+			return Arena;
+		}
+	}
+
+	return nullptr;
+}
+
+int32 UShooterArenaSubsystem::GetArenaIndexFor(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return INDEX_NONE;
+	}
+
+	// players belong to the arena they were assigned to
+	const AShooterPlayerState* PlayerState = nullptr;
+
+	if (const AController* Controller = Cast<AController>(Actor))
+	{
+		PlayerState = Controller->GetPlayerState<AShooterPlayerState>();
+	}
+	else if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		PlayerState = Pawn->GetPlayerState<AShooterPlayerState>();
+	}
+	else if (const APawn* Instigator = Actor->GetInstigator())
+	{
+		// projectiles follow whoever fired them
+		return GetArenaIndexFor(Instigator);
+	}
+
+	if (PlayerState && PlayerState->ArenaIndex != INDEX_NONE)
+	{
+		return PlayerState->ArenaIndex;
+	}
+
+	// everything else belongs to the arena it's in
+	const AShooterArena* Arena = GetArenaAt(Actor->GetActorLocation());
+	return Arena ? Arena->ArenaIndex : INDEX_NONE;
+}
+
+bool UShooterArenaSubsystem::IsRelevantInArena(const AActor* Actor, const AActor* RealViewer, const AActor* ViewTarget) const
+{
+	if (Arenas.Num() == 0)
+	{
+		return true;
+	}
+
+	// actors outside of any arena are shared
+	const int32 ActorArena = GetArenaIndexFor(Actor);
+	if (ActorArena == INDEX_NONE)
+	{
+		return true;
+	}
+
+	int32 ViewerArena = GetArenaIndexFor(RealViewer);
+	if (ViewerArena == INDEX_NONE)
+	{
+		ViewerArena = GetArenaIndexFor(ViewTarget);
+	}
+
+	return ViewerArena == INDEX_NONE || ViewerArena == ActorArena;
+}
+
+bool UShooterArenaSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,63 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterArenaSubsystem.generated.h"
+
+class AShooterArena;
+class AShooterPlayerState;
+
+/**
+ *  Keeps track of the arenas in the level and which one each player and actor belongs to
+ *  Does nothing when the level has no arenas, so single match levels behave as before
+ */
+UCLASS()
+class MULTI_API UShooterArenaSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds an arena. The server assigns its index */
+	void RegisterArena(AShooterArena* Arena);
+
+	/** Removes an arena */
+	void UnregisterArena(AShooterArena* Arena);
+
+	/** Returns true if the level hosts any arenas */
+	bool HasArenas() const { return Arenas.Num() > 0; }
+
+	/** Puts the player in the least populated arena with room. Returns the arena, if any */
+	AShooterArena* AssignPlayer(AShooterPlayerState* PlayerState);
+
+	/** Takes the player out of their arena */
+	void ReleasePlayer(AShooterPlayerState* PlayerState);
+
+	/** Returns the arena with the given index */
+	AShooterArena* GetArena(int32 ArenaIndex) const;
+
+	/** Returns the arena containing the location */
+	AShooterArena* GetArenaAt(const FVector& Location) const;
+
+	/** Returns the arena index for a controller, pawn or placed actor, or INDEX_NONE if it's shared */
+	int32 GetArenaIndexFor(const AActor* Actor) const;
+
+	/** Returns false if the actor and the viewer are in different arenas */
+	bool IsRelevantInArena(const AActor* Actor, const AActor* RealViewer, const AActor* ViewTarget) const;
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Arenas in the level */
+	UPROPERTY()
+	TArray<TObjectPtr<AShooterArena>> Arenas;
+
+	/** Index for the next registered arena */
+	int32 NextArenaIndex = 0;
+};
@@ -7,6 +7,7 @@
 #include "ShooterPlayerController.h"
 #include "ShooterGameMode.h"
 #include "ShooterGameState.h"
+#include "ShooterClockSyncComponent.h"
 
 AShooterCharacter* UShooterBPLibrary::GetShooterCharacter(const UObject* WorldContextObject, int32 PlayerIndex)
 {
@@ -45,4 +46,22 @@ AShooterGameState* UShooterBPLibrary::GetShooterGameState(const UObject* WorldCo
 		return Cast<AShooterGameState>(World->GetGameState());
 	}
 	return nullptr;
+}
+
+double UShooterBPLibrary::GetServerTime(const UObject* WorldContextObject)
+{
+	if (AShooterPlayerController* PC = GetShooterController(WorldContextObject))
+	{
+		if (PC->GetClockSync() && PC->GetClockSync()->HasSyncedTime())
+		{
+			return PC->GetClockSync()->GetServerTime();
+		}
+	}
+
+	if (AShooterGameState* GameState = GetShooterGameState(WorldContextObject))
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return 0.0;
 }
\ No newline at end of file
@@ -26,4 +26,8 @@ public:
 
 	UFUNCTION(BlueprintPure)
 	static class AShooterGameState* GetShooterGameState(const UObject* WorldContextObject);
+
+	/** Returns the synced server time, falling back to the replicated GameState time before the first sync */
+	UFUNCTION(BlueprintPure)
+	static double GetServerTime(const UObject* WorldContextObject);
 };
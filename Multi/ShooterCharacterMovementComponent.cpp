@@ -0,0 +1,209 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterCharacterMovementComponent.h"
+#include "GameFramework/Character.h"
+
+FSavedMove_Shooter::FSavedMove_Shooter()
+{
+	bSavedWantsToSprint = false;
+
+	// acceleration is quantized, so small differences are real input changes. Combine more eagerly
+	AccelDotThresholdCombine = 0.99f;
+	MaxSpeedThresholdCombine = 25.0f;
+}
+
+void FSavedMove_Shooter::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToSprint = false;
+}
+
+uint8 FSavedMove_Shooter::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	if (bSavedWantsToSprint)
+	{
+		Result |= FLAG_Custom_0;
+	}
+
+	return Result;
+}
+
+bool FSavedMove_Shooter::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	// never combine across a sprint state change
+	if (bSavedWantsToSprint != static_cast<const FSavedMove_Shooter*>(NewMove.Get())->bSavedWantsToSprint)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Shooter::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (UShooterCharacterMovementComponent* Movement = Cast<UShooterCharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToSprint = Movement->bWantsToSprint;
+	}
+}
+
+void FSavedMove_Shooter::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (UShooterCharacterMovementComponent* Movement = Cast<UShooterCharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		Movement->bWantsToSprint = bSavedWantsToSprint;
+	}
+}
+
+////////////////////////////////////////////////////////////////////
+
+FNetworkPredictionData_Client_Shooter::FNetworkPredictionData_Client_Shooter(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Shooter::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Shooter());
+}
+
+////////////////////////////////////////////////////////////////////
+
+bool FShooterCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	NetworkMoveType = MoveType;
+
+	bool bLocalSuccess = true;
+	const bool bIsSaving = Ar.IsSaving();
+
+	Ar << TimeStamp;
+
+	// acceleration is quantized to AccelQuantizationSteps per axis, so a signed byte per axis is lossless
+	const float MaxAccel = FMath::Max(CharacterMovement.GetMaxAcceleration(), UE_KINDA_SMALL_NUMBER);
+	const float Steps = UShooterCharacterMovementComponent::AccelQuantizationSteps;
+
+	int8 PackedAccel[3] = { 0, 0, 0 };
+	bool bHasAccel = false;
+
+	if (bIsSaving)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			PackedAccel[Axis] = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(Acceleration[Axis] / MaxAccel * Steps), -127, 127));
+			bHasAccel |= PackedAccel[Axis] != 0;
+		}
+	}
+
+	// a single bit covers the common idle case
+	Ar.SerializeBits(&bHasAccel, 1);
+
+	if (bHasAccel)
+	{
+		Ar.Serialize(PackedAccel, sizeof(PackedAccel));
+	}
+
+	if (!bIsSaving)
+	{
+		Acceleration = FVector(PackedAccel[0] / Steps, PackedAccel[1] / Steps, PackedAccel[2] / Steps) * MaxAccel;
+	}
+
+	Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
+	ControlRotation.NetSerialize(Ar, PackageMap, bLocalSuccess);
+	SerializeOptionalValue<uint8>(bIsSaving, Ar, CompressedMoveFlags, 0);
+
+	// movement base and mode are only used for error checking, so only send them on the final move
+	if (MoveType == ENetworkMoveType::NewMove)
+	{
+		SerializeOptionalValue<UPrimitiveComponent*>(bIsSaving, Ar, MovementBase, nullptr);
+		SerializeOptionalValue<FName>(bIsSaving, Ar, MovementBaseBoneName, NAME_None);
+		SerializeOptionalValue<uint8>(bIsSaving, Ar, MovementMode, MOVE_Walking);
+	}
+
+	return !Ar.IsError();
+}
+
+FShooterCharacterNetworkMoveDataContainer::FShooterCharacterNetworkMoveDataContainer()
+{
+	NewMoveData = &ShooterMoveData[0];
+	PendingMoveData = &ShooterMoveData[1];
+	OldMoveData = &ShooterMoveData[2];
+}
+
+////////////////////////////////////////////////////////////////////
+
+UShooterCharacterMovementComponent::UShooterCharacterMovementComponent()
+{
+	bWantsToSprint = false;
+
+	// use the packed move data
+	SetNetworkMoveDataContainer(ShooterMoveDataContainer);
+
+	// allow predicted crouching
+	NavAgentProps.bCanCrouch = true;
+
+	// configure character movement
+	BrakingDecelerationFalling = 1500.0f;
+	AirControl = 0.5f;
+}
+
+void UShooterCharacterMovementComponent::SetSprinting(bool bSprint)
+{
+	bWantsToSprint = bSprint;
+}
+
+bool UShooterCharacterMovementComponent::IsSprinting() const
+{
+	return bWantsToSprint && IsMovingOnGround() && !IsCrouching();
+}
+
+float UShooterCharacterMovementComponent::GetMaxSpeed() const
+{
+	const float MaxSpeed = Super::GetMaxSpeed();
+
+	return IsSprinting() ? MaxSpeed * SprintSpeedMultiplier : MaxSpeed;
+}
+
+FNetworkPredictionData_Client* UShooterCharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UShooterCharacterMovementComponent* MutableThis = const_cast<UShooterCharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Shooter(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UShooterCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToSprint = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+}
+
+FVector UShooterCharacterMovementComponent::ScaleInputAcceleration(const FVector& InputPulse) const
+{
+	// quantize the input direction so the client simulates with exactly what the server will unpack
+	const float Steps = AccelQuantizationSteps;
+	FVector Pulse = InputPulse.GetClampedToMaxSize(1.0f);
+
+	Pulse.X = FMath::RoundToFloat(Pulse.X * Steps) / Steps;
+	Pulse.Y = FMath::RoundToFloat(Pulse.Y * Steps) / Steps;
+	Pulse.Z = FMath::RoundToFloat(Pulse.Z * Steps) / Steps;
+
+	return GetMaxAcceleration() * Pulse;
+}
+
+float UShooterCharacterMovementComponent::GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const
+{
+	// high frame rate clients hold unimportant moves back so they get combined before sending
+	return FMath::Max(Super::GetClientNetSendDeltaTime(PC, ClientData, NewMove), 1.0f / MaxClientMoveSendRate);
+}
@@ -0,0 +1,124 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "ShooterCharacterMovementComponent.generated.h"
+
+/**
+ *  Saved move with sprint support and relaxed combine thresholds
+ *  Acceleration is already quantized by the component so identical inputs produce identical moves
+ */
+class FSavedMove_Shooter : public FSavedMove_Character
+{
+public:
+
+	typedef FSavedMove_Character Super;
+
+	/** Constructor */
+	FSavedMove_Shooter();
+
+	/** Sprint flag at the time of this move */
+	uint8 bSavedWantsToSprint : 1;
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+};
+
+/**
+ *  Client prediction data that allocates shooter saved moves
+ */
+class FNetworkPredictionData_Client_Shooter : public FNetworkPredictionData_Client_Character
+{
+public:
+
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	/** Constructor */
+	FNetworkPredictionData_Client_Shooter(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+/**
+ *  Network move data that packs the quantized acceleration into a byte per axis
+ */
+struct FShooterCharacterNetworkMoveData : public FCharacterNetworkMoveData
+{
+	typedef FCharacterNetworkMoveData Super;
+
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+/**
+ *  Container holding the shooter network move data for the new, pending and old moves
+ */
+struct FShooterCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+	/** Constructor */
+	FShooterCharacterNetworkMoveDataContainer();
+
+	/** Storage for the new, pending and old moves */
+	FShooterCharacterNetworkMoveData ShooterMoveData[3];
+};
+
+/**
+ *  Character movement for the shooter game
+ *  Adds sprint and crouch as predicted flags
+ *  Quantizes input acceleration and packs it in saved moves to save upstream bandwidth
+ *  Caps how often clients send moves so high frame rate clients combine moves instead of flooding the server
+ */
+UCLASS()
+class MULTI_API UShooterCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UShooterCharacterMovementComponent();
+
+	/** Number of steps per axis used to quantize input acceleration. Must fit in a signed byte */
+	static constexpr int32 AccelQuantizationSteps = 127;
+
+	/** Max walk speed multiplier while sprinting */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Character Movement: Sprint", meta = (ClampMin = 1, ClampMax = 3))
+	float SprintSpeedMultiplier = 1.5f;
+
+	/** Max number of move RPCs per second a client sends. Extra frames are combined into pending moves. Kept below the engine's ~60 Hz default so it actually batches */
+	UPROPERTY(EditAnywhere, Category="Character Movement (Networking)", meta = (ClampMin = 10, ClampMax = 240))
+	float MaxClientMoveSendRate = 30.0f;
+
+	/** If true, the character wants to sprint */
+	uint8 bWantsToSprint : 1;
+
+	/** Sets the sprint input state */
+	UFUNCTION(BlueprintCallable, Category="Character Movement: Sprint")
+	void SetSprinting(bool bSprint);
+
+	/** Returns true if the character is currently sprinting */
+	UFUNCTION(BlueprintPure, Category="Character Movement: Sprint")
+	bool IsSprinting() const;
+
+	//~Begin UCharacterMovementComponent interface
+	virtual float GetMaxSpeed() const override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	//~End UCharacterMovementComponent interface
+
+protected:
+
+	//~Begin UCharacterMovementComponent interface
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual FVector ScaleInputAcceleration(const FVector& InputPulse) const override;
+	virtual float GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const override;
+	//~End UCharacterMovementComponent interface
+
+private:
+
+	/** Packed network move data storage */
+	FShooterCharacterNetworkMoveDataContainer ShooterMoveDataContainer;
+};
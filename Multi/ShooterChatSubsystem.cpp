@@ -0,0 +1,144 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterChatSubsystem.h"
+#include "GameFramework/GameStateBase.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+bool UShooterChatSubsystem::SendMessage(AShooterPlayerState* Sender, bool bTeamOnly, const FString& Message)
+{
+	if (!Sender || Message.IsEmpty() || !ConsumeToken(Sender))
+	{
+		return false;
+	}
+
+	FShooterChatMessage ChatMessage;
+	ChatMessage.ChatTeam = bTeamOnly ? Sender->Team : EShooterTeam::None;
+	ChatMessage.SenderName = Sender->GetPlayerName();
+	ChatMessage.Message = Message.Left(MaxMessageLength);
+
+	// players in other arenas don't see each other's chat
+	if (const AGameStateBase* GameState = GetWorld()->GetGameState())
+	{
+		for (APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			AShooterPlayerState* Recipient = Cast<AShooterPlayerState>(PlayerState);
+			if (Recipient && CanSee(Recipient, ChatMessage.ChatTeam, Sender->ArenaIndex))
+			{
+				Enqueue(Recipient, ChatMessage);
+			}
+		}
+	}
+
+	AddToHistory(ChatMessage, Sender->ArenaIndex);
+
+	return true;
+}
+
+void UShooterChatSubsystem::SendHistory(AShooterPlayerState* PlayerState)
+{
+	if (!PlayerState)
+	{
+		return;
+	}
+
+	// unroll the ring buffer oldest first
+	for (int32 Offset = 0; Offset < History.Num(); ++Offset)
+	{
+		const TPair<FShooterChatMessage, int32>& Entry = History[(NextHistorySlot + Offset) % History.Num()];
+
+		if (CanSee(PlayerState, Entry.Key.ChatTeam, Entry.Value))
+		{
+			Enqueue(PlayerState, Entry.Key);
+		}
+	}
+}
+
+void UShooterChatSubsystem::RemovePlayer(AShooterPlayerState* PlayerState)
+{
+	Buckets.Remove(PlayerState);
+	Outgoing.Remove(PlayerState);
+}
+
+bool UShooterChatSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UShooterChatSubsystem::ConsumeToken(AShooterPlayerState* Sender)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	FTokenBucket* Bucket = Buckets.Find(Sender);
+	if (!Bucket)
+	{
+		// new players start with a full bucket
+		Bucket = &Buckets.Add(Sender);
+		Bucket->Tokens = BurstSize;
+		Bucket->LastRefillTime = Now;
+	}
+
+	Bucket->Tokens = FMath::Min(BurstSize, Bucket->Tokens + static_cast<float>(Now - Bucket->LastRefillTime) * MessagesPerSecond);
+	Bucket->LastRefillTime = Now;
+
+	if (Bucket->Tokens < 1.0f)
+	{
+		return false;
+	}
+
+	Bucket->Tokens -= 1.0f;
+	return true;
+}
+
+void UShooterChatSubsystem::Enqueue(AShooterPlayerState* Recipient, const FShooterChatMessage& Message)
+{
+	// send everything queued this frame in one go
+	if (Outgoing.Num() == 0)
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UShooterChatSubsystem::Flush));
+	}
+
+	Outgoing.FindOrAdd(Recipient).Add(Message);
+}
+
+void UShooterChatSubsystem::AddToHistory(const FShooterChatMessage& Message, int32 ArenaIndex)
+{
+	if (HistorySize <= 0)
+	{
+		return;
+	}
+
+	if (History.Num() < HistorySize)
+	{
+		History.Emplace(Message, ArenaIndex);
+		return;
+	}
+
+	// overwrite the oldest message
+	History[NextHistorySlot] = TPair<FShooterChatMessage, int32>(Message, ArenaIndex);
+	NextHistorySlot = (NextHistorySlot + 1) % History.Num();
+}
+
+bool UShooterChatSubsystem::CanSee(const AShooterPlayerState* PlayerState, EShooterTeam ChatTeam, int32 ArenaIndex)
+{
+	if (PlayerState->ArenaIndex != ArenaIndex)
+	{
+		return false;
+	}
+
+	return ChatTeam == EShooterTeam::None || PlayerState->Team == ChatTeam;
+}
+
+void UShooterChatSubsystem::Flush()
+{
+	for (TPair<TWeakObjectPtr<AShooterPlayerState>, TArray<FShooterChatMessage>>& Pending : Outgoing)
+	{
+		if (AShooterPlayerState* Recipient = Pending.Key.Get())
+		{
+			Recipient->ClientReceiveChatMessages(Pending.Value);
+		}
+	}
+
+	Outgoing.Reset();
+}
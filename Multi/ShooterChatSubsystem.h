@@ -0,0 +1,88 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterPlayerState.h"
+#include "ShooterChatSubsystem.generated.h"
+
+/**
+ *  Routes chat on the server
+ *  The sender is always the player state the message arrived through, never a client provided name
+ *  Each player has a token bucket for flood control, and everything a player receives in a frame goes out in one RPC
+ *  Recent messages are kept in a bounded history and sent to players as they join
+ */
+UCLASS()
+class MULTI_API UShooterChatSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Sends a message from the player to all chat, or to their team. Returns false if it was rate limited */
+	bool SendMessage(AShooterPlayerState* Sender, bool bTeamOnly, const FString& Message);
+
+	/** Sends the history the player is allowed to see */
+	void SendHistory(AShooterPlayerState* PlayerState);
+
+	/** Forgets the player's rate limit state */
+	void RemovePlayer(AShooterPlayerState* PlayerState);
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Messages a player can send in a burst */
+	UPROPERTY(EditAnywhere, Category="Chat", meta = (ClampMin = 1))
+	float BurstSize = 5.0f;
+
+	/** Messages per second a player earns back */
+	UPROPERTY(EditAnywhere, Category="Chat", meta = (ClampMin = 0))
+	float MessagesPerSecond = 1.0f;
+
+	/** Longer messages are truncated */
+	UPROPERTY(EditAnywhere, Category="Chat", meta = (ClampMin = 1))
+	int32 MaxMessageLength = 200;
+
+	/** Number of messages kept for late joiners */
+	UPROPERTY(EditAnywhere, Category="Chat", meta = (ClampMin = 0))
+	int32 HistorySize = 32;
+
+private:
+
+	/** Rate limit state for a player */
+	struct FTokenBucket
+	{
+		float Tokens = 0.0f;
+		double LastRefillTime = 0.0;
+	};
+
+	/** Rate limit state by player */
+	TMap<TWeakObjectPtr<AShooterPlayerState>, FTokenBucket> Buckets;
+
+	/** Messages waiting to be sent, by recipient */
+	TMap<TWeakObjectPtr<AShooterPlayerState>, TArray<FShooterChatMessage>> Outgoing;
+
+	/** Recent messages with their sender's arena, oldest first once unrolled from NextHistorySlot */
+	TArray<TPair<FShooterChatMessage, int32>> History;
+
+	/** Slot the next history message goes into once the history is full */
+	int32 NextHistorySlot = 0;
+
+	/** Takes a token from the player's bucket. Returns false if it's empty */
+	bool ConsumeToken(AShooterPlayerState* Sender);
+
+	/** Queues a message for the recipient and schedules a flush */
+	void Enqueue(AShooterPlayerState* Recipient, const FShooterChatMessage& Message);
+
+	/** Adds a message to the history */
+	void AddToHistory(const FShooterChatMessage& Message, int32 ArenaIndex);
+
+	/** Returns true if the player can see a message sent to the team from the arena */
+	static bool CanSee(const AShooterPlayerState* PlayerState, EShooterTeam ChatTeam, int32 ArenaIndex);
+
+	/** Sends each recipient their queued messages in a single RPC */
+	void Flush();
+};
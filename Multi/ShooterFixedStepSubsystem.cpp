@@ -0,0 +1,106 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterFixedStepSubsystem.h"
+#include "Multi.h"
+
+void UShooterFixedStepSubsystem::SetTimer(FShooterStepTimerHandle& InOutHandle, FSimpleDelegate&& Callback, float Delay)
+{
+	// replace any timer already using this handle
+	ClearTimer(InOutHandle);
+
+	FStepTimer& Timer = Timers.AddDefaulted_GetRef();
+	Timer.Id = ++LastTimerId;
+	Timer.FireStep = StepCount + FMath::Max(1, FMath::CeilToInt(Delay / GetStepSeconds()));
+	Timer.Callback = MoveTemp(Callback);
+
+	InOutHandle.Id = Timer.Id;
+}
+
+void UShooterFixedStepSubsystem::ClearTimer(FShooterStepTimerHandle& InOutHandle)
+{
+	if (InOutHandle.IsValid())
+	{
+		Timers.RemoveAllSwap([Id = InOutHandle.Id](const FStepTimer& Timer) { return Timer.Id == Id; });
+		InOutHandle.Invalidate();
+	}
+}
+
+bool UShooterFixedStepSubsystem::IsTimerActive(const FShooterStepTimerHandle& Handle) const
+{
+	return Handle.IsValid() && Timers.ContainsByPredicate([Id = Handle.Id](const FStepTimer& Timer) { return Timer.Id == Id; });
+}
+
+float UShooterFixedStepSubsystem::GetTimerRemaining(const FShooterStepTimerHandle& Handle) const
+{
+	if (const FStepTimer* Timer = Timers.FindByPredicate([Id = Handle.Id](const FStepTimer& Timer) { return Timer.Id == Id; }))
+	{
+		return (Timer->FireStep - StepCount) * GetStepSeconds();
+	}
+
+	return -1.0f;
+}
+
+void UShooterFixedStepSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const float StepSeconds = GetStepSeconds();
+	Accumulator += DeltaTime;
+
+	int32 StepsThisFrame = 0;
+
+	while (Accumulator >= StepSeconds)
+	{
+		// budget guard: drop the backlog instead of trying to catch up forever
+		if (StepsThisFrame >= MaxStepsPerFrame)
+		{
+			UE_LOG(LogMulti, Verbose, TEXT("Fixed step over budget, dropping %.3fs of simulation"), Accumulator - FMath::Fmod(Accumulator, StepSeconds));
+			Accumulator = FMath::Fmod(Accumulator, StepSeconds);
+			break;
+		}
+
+		Step(StepSeconds);
+
+		Accumulator -= StepSeconds;
+		++StepsThisFrame;
+	}
+}
+
+TStatId UShooterFixedStepSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterFixedStepSubsystem, STATGROUP_Tickables);
+}
+
+bool UShooterFixedStepSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShooterFixedStepSubsystem::Step(float StepSeconds)
+{
+	++StepCount;
+
+	// advance the registered systems
+	OnFixedStep.Broadcast(StepSeconds);
+
+	// collect the due timers first, callbacks are allowed to schedule new timers
+	TArray<FStepTimer, TInlineAllocator<8>> DueTimers;
+
+	for (int32 i = Timers.Num() - 1; i >= 0; i--)
+	{
+		if (Timers[i].FireStep <= StepCount)
+		{
+			DueTimers.Add(MoveTemp(Timers[i]));
+			Timers.RemoveAtSwap(i);
+		}
+	}
+
+	// run in scheduling order so results don't depend on array layout
+	DueTimers.Sort([](const FStepTimer& A, const FStepTimer& B) { return A.Id < B.Id; });
+
+	for (FStepTimer& Timer : DueTimers)
+	{
+		Timer.Callback.ExecuteIfBound();
+	}
+}
@@ -0,0 +1,108 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterFixedStepSubsystem.generated.h"
+
+/** Called once per fixed simulation step with the step length in seconds */
+DECLARE_MULTICAST_DELEGATE_OneParam(FShooterFixedStepDelegate, float);
+
+/**
+ *  Handle to a timer scheduled on the fixed simulation step
+ */
+struct FShooterStepTimerHandle
+{
+	/** Returns true if this handle was ever assigned a timer */
+	bool IsValid() const { return Id != 0; }
+
+	/** Clears the handle without touching the timer */
+	void Invalidate() { Id = 0; }
+
+	/** Unique id of the timer */
+	uint64 Id = 0;
+};
+
+/**
+ *  Runs gameplay simulation at a fixed rate, independently of the render and net frame rate
+ *  Accumulates frame time and sub-steps registered systems and timers
+ *  Caps the number of steps per frame to avoid a spiral of death on slow frames
+ */
+UCLASS(Config=Game)
+class MULTI_API UShooterFixedStepSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Broadcast once per simulation step. Systems bind here to advance their simulation */
+	FShooterFixedStepDelegate OnFixedStep;
+
+	/** Schedules a callback to run after the given delay, rounded up to whole simulation steps */
+	void SetTimer(FShooterStepTimerHandle& InOutHandle, FSimpleDelegate&& Callback, float Delay);
+
+	/** Cancels a scheduled timer and invalidates the handle */
+	void ClearTimer(FShooterStepTimerHandle& InOutHandle);
+
+	/** Returns true if the timer is still scheduled */
+	bool IsTimerActive(const FShooterStepTimerHandle& Handle) const;
+
+	/** Returns the time left on the timer, or -1 if it's not active */
+	float GetTimerRemaining(const FShooterStepTimerHandle& Handle) const;
+
+	/** Returns the length of a simulation step in seconds */
+	float GetStepSeconds() const { return 1.0f / FMath::Max(StepRate, 1.0f); }
+
+	/** Returns the number of steps simulated so far */
+	int64 GetStepCount() const { return StepCount; }
+
+	/** Returns the simulated time in seconds. Advances in whole steps only */
+	double GetSimulationTime() const { return StepCount * static_cast<double>(GetStepSeconds()); }
+
+	/** Returns how far the render frame is between the last step and the next one, for interpolation */
+	float GetInterpolationAlpha() const { return Accumulator / GetStepSeconds(); }
+
+	//~Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End FTickableGameObject interface
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Number of simulation steps per second */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation", meta = (ClampMin = 10, ClampMax = 240))
+	float StepRate = 60.0f;
+
+	/** Max number of steps run in a single frame. Any time beyond this is dropped */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation", meta = (ClampMin = 1, ClampMax = 32))
+	int32 MaxStepsPerFrame = 4;
+
+private:
+
+	/** A callback scheduled for a given step */
+	struct FStepTimer
+	{
+		uint64 Id = 0;
+		int64 FireStep = 0;
+		FSimpleDelegate Callback;
+	};
+
+	/** Scheduled timers */
+	TArray<FStepTimer> Timers;
+
+	/** Last assigned timer id */
+	uint64 LastTimerId = 0;
+
+	/** Unsimulated frame time */
+	float Accumulator = 0.0f;
+
+	/** Steps simulated so far */
+	int64 StepCount = 0;
+
+	/** Advances the simulation by one step */
+	void Step(float StepSeconds);
+};
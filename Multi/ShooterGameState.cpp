@@ -5,39 +5,143 @@
 #include "ShooterPlayerController.h"
 #include "ShooterBPLibrary.h"
 #include "ShooterGameMode.h"
+#include "TimerManager.h"
+#include "ShooterArenaSubsystem.h"
+#include "ShooterPlayerState.h"
+#include "Algo/Reverse.h"
+#include "Algo/StableSort.h"
+#include "GameFramework/PlayerState.h"
+#include "ShooterMapPreloadSubsystem.h"
+#include "Engine/GameInstance.h"
 #include "Net/UnrealNetwork.h"
 
 AShooterGameState::AShooterGameState()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// The countdown is driven by ready state changes and a timer, so there's nothing to tick
+	PrimaryActorTick.bCanEverTick = false;
+
+	Scoreboard.Owner = this;
+	KillFeed.Owner = this;
+}
+
+void AShooterGameState::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (HasAuthority())
+	{
+		GetWorldTimerManager().SetTimer(ScoreboardPingTimer, this, &AShooterGameState::UpdateScoreboardPings, ScoreboardPingInterval, true);
+	}
+	else
+	{
+		// clients begin play after the initial update, so the kills in it are history
+		KillFeed.SetJoinServerTime(GetServerWorldTimeSeconds());
+	}
+}
+
+void AShooterGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorldTimerManager().ClearTimer(MatchStartTimer);
+	GetWorldTimerManager().ClearTimer(ScoreboardPingTimer);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AShooterGameState::AddPlayerState(APlayerState* PlayerState)
+{
+	Super::AddPlayerState(PlayerState);
+
+	if (HasAuthority())
+	{
+		Scoreboard.AddPlayer(PlayerState);
+	}
+
+	UpdateMatchCountdown();
+}
+
+void AShooterGameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	Super::RemovePlayerState(PlayerState);
+
+	if (HasAuthority())
+	{
+		Scoreboard.RemovePlayer(PlayerState);
+	}
+
+	UpdateMatchCountdown();
 }
 
-void AShooterGameState::Tick(float DeltaSeconds)
+float AShooterGameState::GetWaitingToStartRemaining() const
 {
-	Super::Tick(DeltaSeconds);
+	// Not everyone is ready, show the full countdown
+	if (MatchStartServerTime <= 0.0)
+	{
+		const AShooterGameMode* GameMode = GetDefaultGameMode<AShooterGameMode>();
+		return GameMode ? GameMode->WaitingToStartDuration : 0.0f;
+	}
+
+	return FMath::Max(0.0f, static_cast<float>(MatchStartServerTime - UShooterBPLibrary::GetServerTime(this)));
+}
 
-	// Check if Waiting To Start
-	if (GetMatchState() == MatchState::WaitingToStart)
+void AShooterGameState::UpdateMatchCountdown()
+{
+	if (GetLocalRole() != ROLE_Authority)
 	{
-		// Check if PlayerArray has more than 0 players AND PlayersReady is equal to number players in Player Array 
-		if (PlayerArray.Num() > 0 && PlayersReady == PlayerArray.Num())
+		return;
+	}
+
+	// spectators never ready up. Counting from the player states keeps leaving players out
+	int32 NumPlayers = 0;
+	PlayersReady = 0;
+
+	for (const APlayerState* PlayerState : PlayerArray)
+	{
+		if (PlayerState && !PlayerState->IsOnlyASpectator())
 		{
-			WaitingToStartTime -= DeltaSeconds;
-			if (WaitingToStartTime <= 0.0f)
-			{
-				WaitingToStartTime = 0.0f;
-				// On server, actually start the match!
-				if (GetLocalRole() == ROLE_Authority)
-				{
-					if (AShooterGameMode* GameMode = UShooterBPLibrary::GetShooterGameMode(this))
-					{
-						GameMode->StartMatch();
-						MulticastOnAlert(TEXT("STARTING MATCH"), FLinearColor::Green, 3.0f);
-					}
-				}
-			}	
+			++NumPlayers;
+
+			const AShooterPlayerState* ShooterPlayerState = Cast<AShooterPlayerState>(PlayerState);
+			PlayersReady += ShooterPlayerState && ShooterPlayerState->bIsReady ? 1 : 0;
 		}
 	}
+
+	// Check if Waiting To Start, there are players AND every player is ready
+	const bool bEveryoneReady = GetMatchState() == MatchState::WaitingToStart && NumPlayers > 0 && PlayersReady == NumPlayers;
+
+	if (bEveryoneReady && MatchStartServerTime <= 0.0)
+	{
+		// Start the countdown. Clients count down on their own from the replicated start time
+		const AShooterGameMode* GameMode = GetDefaultGameMode<AShooterGameMode>();
+		const float Duration = GameMode ? GameMode->WaitingToStartDuration : 0.0f;
+
+		MatchStartServerTime = GetServerWorldTimeSeconds() + Duration;
+		GetWorldTimerManager().SetTimer(MatchStartTimer, this, &AShooterGameState::OnMatchStartTimer, FMath::Max(Duration, KINDA_SMALL_NUMBER), false);
+		OnRep_MatchStartServerTime();
+	}
+	else if (!bEveryoneReady && MatchStartServerTime > 0.0)
+	{
+		// Someone unreadied or left, cancel the countdown
+		MatchStartServerTime = 0.0;
+		GetWorldTimerManager().ClearTimer(MatchStartTimer);
+		OnRep_MatchStartServerTime();
+	}
+}
+
+void AShooterGameState::OnMatchStartTimer()
+{
+	MatchStartServerTime = 0.0;
+	OnRep_MatchStartServerTime();
+
+	// On server, actually start the match!
+	if (AShooterGameMode* GameMode = UShooterBPLibrary::GetShooterGameMode(this))
+	{
+		GameMode->StartMatch();
+
+		FShooterAlert Alert;
+		Alert.Type = EShooterAlert::MatchStarting;
+		Alert.Color = EShooterAlertColor::Green;
+		SendAlert(Alert);
+	}
 }
 
 void AShooterGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -47,28 +151,176 @@ void AShooterGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 	DOREPLIFETIME(AShooterGameState, RedTeamScore);
 	DOREPLIFETIME(AShooterGameState, BlueTeamScore);
 	DOREPLIFETIME(AShooterGameState, PlayersReady);
+	DOREPLIFETIME(AShooterGameState, Scoreboard);
+	DOREPLIFETIME(AShooterGameState, KillFeed);
+	DOREPLIFETIME(AShooterGameState, NextMap);
 		 
-	// Only send this on the "initial bunch" when the client first gets this actor replicated
-	DOREPLIFETIME_CONDITION(AShooterGameState, WaitingToStartTime, COND_InitialOnly);
+	DOREPLIFETIME(AShooterGameState, MatchStartServerTime);
+}
+
+void AShooterGameState::UpdateScoreboardPings()
+{
+	Scoreboard.UpdatePings(PlayerArray);
+
+	// spectators can lift their own bandwidth cap with the netspeed command
+	if (AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>())
+	{
+		GameMode->ClampSpectatorNetSpeeds();
+	}
 }
 
 void AShooterGameState::HandleMatchIsWaitingToStart()
 {
 	Super::HandleMatchIsWaitingToStart();
 
-	// If we're on the server, set the waiting to start time
-	if (GetLocalRole() == ROLE_Authority)
+	// Players may have readied up before the match went back to waiting
+	UpdateMatchCountdown();
+}
+
+void AShooterGameState::Reset()
+{
+	Super::Reset();
+
+	RedTeamScore = 0;
+	BlueTeamScore = 0;
+	OnRep_TeamScores();
+	Scoreboard.ResetAll();
+	KillFeed.Reset();
+
+	// everyone has to ready up again. Player states may reset after us
+	for (APlayerState* PlayerState : PlayerArray)
 	{
-		WaitingToStartTime = GetDefaultGameMode<AShooterGameMode>()->WaitingToStartDuration;
+		if (AShooterPlayerState* ShooterPlayerState = Cast<AShooterPlayerState>(PlayerState))
+		{
+			ShooterPlayerState->bIsReady = false;
+		}
+	}
+
+	UpdateMatchCountdown();
+}
+
+void AShooterGameState::AddTeamScore(EShooterTeam Team)
+{
+	if (Team == EShooterTeam::Red)
+	{
+		RedTeamScore++;
+	}
+	else if (Team == EShooterTeam::Blue)
+	{
+		BlueTeamScore++;
+	}
+
+	// the server doesn't get the rep notify
+	OnRep_TeamScores();
+}
+
+void AShooterGameState::OnRep_TeamScores()
+{
+	OnHUDStateChanged.Broadcast();
+}
+
+void AShooterGameState::OnRep_MatchStartServerTime()
+{
+	OnHUDStateChanged.Broadcast();
+}
+
+void AShooterGameState::OnRep_MatchState()
+{
+	Super::OnRep_MatchState();
+
+	OnHUDStateChanged.Broadcast();
+}
+
+void AShooterGameState::SetNextMap(const FString& MapName)
+{
+	NextMap = MapName;
+
+	// the server preloads too
+	OnRep_NextMap();
+}
+
+void AShooterGameState::OnRep_NextMap()
+{
+	if (NextMap.IsEmpty())
+	{
+		return;
+	}
+
+	// stream the map in while the end of match screen is up
+	if (UShooterMapPreloadSubsystem* MapPreload = GetGameInstance()->GetSubsystem<UShooterMapPreloadSubsystem>())
+	{
+		MapPreload->PreloadMap(NextMap);
+	}
+}
+
+void AShooterGameState::SendAlert(const APlayerState* ScopePlayer, const FShooterAlert& Alert)
+{
+	FShooterAlert ScopedAlert = Alert;
+
+	// only the player's arena sees the alert
+	if (UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		ScopedAlert.ArenaIndex = Arenas->GetArenaIndexFor(ScopePlayer ? ScopePlayer->GetOwningController() : nullptr);
+	}
+
+	SendAlert(ScopedAlert);
+}
+
+void AShooterGameState::SendAlert(const FShooterAlert& Alert)
+{
+	// send everything raised this frame in one go
+	if (PendingAlerts.Num() == 0)
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &AShooterGameState::FlushAlerts);
 	}
 
+	// a newer alert replaces an older one of the same type and subject
+	PendingAlerts.RemoveAll([&Alert](const FShooterAlert& Pending)
+	{
+		return Pending.Type == Alert.Type && Pending.Player == Alert.Player && Pending.ArenaIndex == Alert.ArenaIndex;
+	});
+
+	PendingAlerts.Add(Alert);
 }
 
-void AShooterGameState::MulticastOnAlert_Implementation(const FString& Text, FLinearColor Color, float Duration)
+void AShooterGameState::FlushAlerts()
+{
+	if (PendingAlerts.Num() == 0)
+	{
+		return;
+	}
+
+	// highest priority first, newest first among equals
+	Algo::Reverse(PendingAlerts);
+	Algo::StableSortBy(PendingAlerts, [](const FShooterAlert& Alert) { return ShooterAlerts::GetPriority(Alert.Type); }, TGreater<>());
+
+	if (PendingAlerts.Num() > MaxAlertsPerFlush)
+	{
+		PendingAlerts.SetNum(MaxAlertsPerFlush);
+	}
+
+	MulticastAlerts(PendingAlerts);
+	PendingAlerts.Reset();
+}
+
+void AShooterGameState::MulticastAlerts_Implementation(const TArray<FShooterAlert>& Alerts)
 {
 	AShooterPlayerController* PlayerController = UShooterBPLibrary::GetShooterController(this, 0);
-	if (PlayerController)
+	if (!PlayerController)
 	{
-		PlayerController->OnAlert(Text, Color, Duration);
+		return;
+	}
+
+	const AShooterPlayerState* PlayerState = PlayerController->GetPlayerState<AShooterPlayerState>();
+	const int32 LocalArena = PlayerState ? PlayerState->ArenaIndex : INDEX_NONE;
+
+	// alerts arrive sorted by priority, show the first one meant for us
+	for (const FShooterAlert& Alert : Alerts)
+	{
+		if (Alert.ArenaIndex == INDEX_NONE || Alert.ArenaIndex == LocalArena)
+		{
+			PlayerController->OnAlert(ShooterAlerts::FormatAlert(Alert, this), ShooterAlerts::GetColor(Alert.Color), ShooterAlerts::GetDuration(Alert.Type));
+			break;
+		}
 	}
 }
@@ -5,8 +5,15 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameState.h"
 #include "GameFramework/GameStateBase.h"
+#include "ShooterAlerts.h"
+#include "ShooterScoreboard.h"
+#include "ShooterKillFeed.h"
+#include "ShooterPlayerState.h"
 #include "ShooterGameState.generated.h"
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnShooterScoreboardChanged, const FShooterScoreboardEntry&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnShooterKillFeedEntry, const FShooterKillFeedEntry&);
+
 /**
  * 
  */
@@ -19,24 +26,121 @@ public:
 	//** Constructor */
 	AShooterGameState();
 
-	virtual void Tick(float DeltaSeconds) override;
+	/** Starts the ping refresh on the server */
+	virtual void BeginPlay() override;
+
+	/** Clears the match start timer */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Re-evaluates the ready check when a player joins */
+	virtual void AddPlayerState(APlayerState* PlayerState) override;
+
+	/** Re-evaluates the ready check when a player leaves */
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
 	
-	UPROPERTY(Replicated)
+	UPROPERTY(ReplicatedUsing = OnRep_TeamScores)
 	int32 RedTeamScore = 0;
 
-	UPROPERTY(Replicated)
+	UPROPERTY(ReplicatedUsing = OnRep_TeamScores)
 	int32 BlueTeamScore = 0;
 
+	/** Adds a point to the team's score */
+	void AddTeamScore(EShooterTeam Team);
+
+	/** Called when the team scores, match state or countdown change */
+	FSimpleMulticastDelegate OnHUDStateChanged;
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-	UPROPERTY(Replicated)
-	float WaitingToStartTime = 0.0f;
+	/** Server time the match starts at, or 0 while not everyone is ready */
+	UPROPERTY(ReplicatedUsing = OnRep_MatchStartServerTime)
+	double MatchStartServerTime = 0.0;
+
+	/** Returns the time left before the match starts, derived from the synced server time */
+	float GetWaitingToStartRemaining() const;
+
+	/** Starts or cancels the pre-match countdown when the ready condition changes. Server only */
+	void UpdateMatchCountdown();
 
 	virtual void HandleMatchIsWaitingToStart() override;
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastOnAlert(const FString& Text, FLinearColor Color, float Duration);
+	/** Queues an alert for everyone in the player's arena, or everyone when there are no arenas. Alerts are sent together at the end of the frame */
+	void SendAlert(const APlayerState* ScopePlayer, const FShooterAlert& Alert);
+
+	/** Queues an alert for everyone */
+	void SendAlert(const FShooterAlert& Alert);
 
+	/** Number of ready players, counted from the player states whenever the ready condition may change */
 	UPROPERTY(Replicated)
 	int32 PlayersReady = 0;
+
+	/** Per player kills, deaths, assists, streak and ping. Only changed rows are replicated */
+	UPROPERTY(Replicated)
+	FShooterScoreboard Scoreboard;
+
+	/** Called when a scoreboard row is added, changed or removed */
+	FOnShooterScoreboardChanged OnScoreboardChanged;
+
+	/** Latest kills. Late joiners get them with the initial replication */
+	UPROPERTY(Replicated)
+	FShooterKillFeed KillFeed;
+
+	/** Called when a kill is added to the kill feed */
+	FOnShooterKillFeedEntry OnKillFeedEntry;
+
+	/** Clears the scores and ready count for a soft match reset */
+	virtual void Reset() override;
+
+	/** Map the server travels to after this match. Clients start loading it as soon as it's known */
+	UPROPERTY(ReplicatedUsing = OnRep_NextMap)
+	FString NextMap;
+
+	/** Sets the next map and starts preloading it */
+	void SetNextMap(const FString& MapName);
+
+protected:
+
+	/** Preloads the next map */
+	UFUNCTION()
+	void OnRep_NextMap();
+
+	/** Updates the HUD */
+	UFUNCTION()
+	void OnRep_TeamScores();
+
+	/** Updates the HUD */
+	UFUNCTION()
+	void OnRep_MatchStartServerTime();
+
+	/** Updates the HUD */
+	virtual void OnRep_MatchState() override;
+
+private:
+	/** Timer to start the match when the countdown ends */
+	FTimerHandle MatchStartTimer;
+
+	/** Starts the match */
+	void OnMatchStartTimer();
+
+	/** Seconds between scoreboard ping refreshes */
+	static constexpr float ScoreboardPingInterval = 2.0f;
+
+	/** Timer to refresh the scoreboard pings */
+	FTimerHandle ScoreboardPingTimer;
+
+	/** Refreshes the scoreboard ping buckets and caps the spectators' net speed again */
+	void UpdateScoreboardPings();
+
+	/** Max number of alerts sent together. Lower priority alerts are dropped */
+	static constexpr int32 MaxAlertsPerFlush = 4;
+
+	/** Alerts raised this frame */
+	TArray<FShooterAlert> PendingAlerts;
+
+	/** Coalesces the pending alerts and sends them */
+	void FlushAlerts();
+
+	/** Shows the highest priority alert for the local player's arena */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastAlerts(const TArray<FShooterAlert>& Alerts);
 };
@@ -0,0 +1,131 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterGameplayCueSubsystem.h"
+#include "ShooterCharacter.h"
+#include "ShooterPlayerController.h"
+#include "ShooterWeapon.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+void UShooterGameplayCueSubsystem::SendCue(EShooterCue Type, AActor* Actor, uint8 Param, bool bCritical)
+{
+	// cues are raised on the server only
+	if (!Actor || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// send everything raised this frame in one go
+	if (PendingCues.Num() == 0)
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UShooterGameplayCueSubsystem::Flush));
+	}
+
+	FPendingCue& Pending = PendingCues.AddDefaulted_GetRef();
+	Pending.Cue.Type = Type;
+	Pending.Cue.Actor = Actor;
+	Pending.Cue.Location = Actor->GetActorLocation();
+	Pending.Cue.Param = Param;
+	Pending.bCritical = bCritical;
+}
+
+void UShooterGameplayCueSubsystem::PlayCues(const TArray<FShooterGameplayCue>& Cues)
+{
+	for (const FShooterGameplayCue& Cue : Cues)
+	{
+		// the actor may have been destroyed or never replicated to us
+		if (!IsValid(Cue.Actor))
+		{
+			continue;
+		}
+
+		switch (Cue.Type)
+		{
+		case EShooterCue::Fire:
+			if (AShooterWeapon* Weapon = Cast<AShooterWeapon>(Cue.Actor))
+			{
+				Weapon->PlayFireCue();
+			}
+			break;
+
+		case EShooterCue::Death:
+			if (AShooterCharacter* Character = Cast<AShooterCharacter>(Cue.Actor))
+			{
+				Character->PlayDeathCue();
+			}
+			break;
+		}
+	}
+}
+
+bool UShooterGameplayCueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShooterGameplayCueSubsystem::Flush()
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		AShooterPlayerController* PlayerController = Cast<AShooterPlayerController>(It->Get());
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		Unreliable.Reset();
+		Reliable.Reset();
+
+		for (const FPendingCue& Pending : PendingCues)
+		{
+			if (!IsValid(Pending.Cue.Actor))
+			{
+				continue;
+			}
+
+			// the owner relies on critical cues, like a shot confirming predicted recoil
+			if (Pending.bCritical && Pending.Cue.Actor->IsOwnedBy(PlayerController))
+			{
+				Reliable.Add(Pending.Cue);
+			}
+			else if (IsRelevantFor(Pending.Cue, PlayerController, ViewLocation))
+			{
+				Unreliable.Add(Pending.Cue);
+			}
+		}
+
+		// newer cues matter more than older ones
+		if (Unreliable.Num() > MaxCuesPerFlush)
+		{
+			Unreliable.RemoveAt(0, Unreliable.Num() - MaxCuesPerFlush);
+		}
+
+		if (Unreliable.Num() > 0)
+		{
+			PlayerController->ClientGameplayCues(Unreliable);
+		}
+
+		if (Reliable.Num() > 0)
+		{
+			PlayerController->ClientCriticalGameplayCues(Reliable);
+		}
+	}
+
+	PendingCues.Reset();
+}
+
+bool UShooterGameplayCueSubsystem::IsRelevantFor(const FShooterGameplayCue& Cue, APlayerController* PlayerController, const FVector& ViewLocation) const
+{
+	if (FVector::DistSquared(ViewLocation, Cue.Location) > FMath::Square(CueCullDistance))
+	{
+		return false;
+	}
+
+	// the client can't play a cue on an actor it doesn't have
+	return Cue.Actor->IsNetRelevantFor(PlayerController, PlayerController->GetViewTarget(), ViewLocation);
+}
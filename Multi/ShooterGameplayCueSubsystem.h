@@ -0,0 +1,101 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterGameplayCueSubsystem.generated.h"
+
+class APlayerController;
+
+/**
+ *  Cosmetic events the server can raise on an actor
+ */
+UENUM()
+enum class EShooterCue : uint8
+{
+	/* A weapon fired a shot. Actor is the weapon */
+	Fire,
+	/* A character died. Actor is the character */
+	Death
+};
+
+/**
+ *  Small cosmetic event record sent from the server
+ */
+USTRUCT()
+struct MULTI_API FShooterGameplayCue
+{
+	GENERATED_BODY()
+
+	/** Cue type */
+	UPROPERTY()
+	EShooterCue Type = EShooterCue::Fire;
+
+	/** Actor the cue plays on */
+	UPROPERTY()
+	TObjectPtr<AActor> Actor;
+
+	/** World location of the cue, used for distance filtering */
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	/** Type specific parameter */
+	UPROPERTY()
+	uint8 Param = 0;
+};
+
+/**
+ *  Gameplay cue channel for cosmetic events
+ *  Server code queues cues, which are filtered by relevancy and distance and sent to each connection in one unreliable RPC per frame
+ *  Losing a cosmetic cue is harmless, so only critical cues take the reliable path, and only to the player owning the actor
+ */
+UCLASS()
+class MULTI_API UShooterGameplayCueSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Queues a cue for every player the actor is relevant to. Critical cues are sent reliably to the player owning the actor */
+	void SendCue(EShooterCue Type, AActor* Actor, uint8 Param = 0, bool bCritical = false);
+
+	/** Plays cues received from the server */
+	static void PlayCues(const TArray<FShooterGameplayCue>& Cues);
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Cues farther than this from a player's view aren't sent to them, unless they're critical and the player owns the actor */
+	UPROPERTY(EditAnywhere, Category="Cues", meta = (ClampMin = 0, Units = "cm"))
+	float CueCullDistance = 8000.0f;
+
+	/** Max number of unreliable cues sent to a player per frame. The oldest ones are dropped */
+	UPROPERTY(EditAnywhere, Category="Cues", meta = (ClampMin = 1))
+	int32 MaxCuesPerFlush = 32;
+
+private:
+
+	/** Cue waiting to be sent */
+	struct FPendingCue
+	{
+		FShooterGameplayCue Cue;
+		bool bCritical = false;
+	};
+
+	/** Cues raised this frame */
+	TArray<FPendingCue> PendingCues;
+
+	/** Per player scratch lists, reused between flushes */
+	TArray<FShooterGameplayCue> Unreliable;
+	TArray<FShooterGameplayCue> Reliable;
+
+	/** Sends each player the cues relevant to them */
+	void Flush();
+
+	/** Returns true if the cue should be sent to the player viewing from the location */
+	bool IsRelevantFor(const FShooterGameplayCue& Cue, APlayerController* PlayerController, const FVector& ViewLocation) const;
+};
@@ -0,0 +1,65 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterKillFeed.h"
+#include "ShooterGameState.h"
+
+void FShooterKillFeedEntry::PostReplicatedAdd(const FShooterKillFeed& InArraySerializer)
+{
+	// the initial update carries the kills from before we joined
+	if (InArraySerializer.Owner && InArraySerializer.IsNewKill(*this))
+	{
+		InArraySerializer.Owner->OnKillFeedEntry.Broadcast(*this);
+	}
+}
+
+void FShooterKillFeedEntry::PostReplicatedChange(const FShooterKillFeed& InArraySerializer)
+{
+	// a reused slot is a new kill
+	if (InArraySerializer.Owner && InArraySerializer.IsNewKill(*this))
+	{
+		InArraySerializer.Owner->OnKillFeedEntry.Broadcast(*this);
+	}
+}
+
+void FShooterKillFeed::AddKill(int32 Killer, int32 Victim, uint8 WeaponId, bool bHeadshot, float ServerTime)
+{
+	FShooterKillFeedEntry* Entry = nullptr;
+
+	if (Entries.Num() < Capacity)
+	{
+		Entry = &Entries.AddDefaulted_GetRef();
+	}
+	else
+	{
+		// reuse the oldest slot
+		Entry = &Entries[NextSlot];
+		NextSlot = (NextSlot + 1) % Capacity;
+	}
+
+	Entry->Killer = Killer;
+	Entry->Victim = Victim;
+	Entry->WeaponId = WeaponId;
+	Entry->bHeadshot = bHeadshot;
+	Entry->ServerTime = ServerTime;
+	MarkItemDirty(*Entry);
+
+	// the server doesn't get replication callbacks
+	if (Owner)
+	{
+		Owner->OnKillFeedEntry.Broadcast(*Entry);
+	}
+}
+
+void FShooterKillFeed::GetKills(TArray<FShooterKillFeedEntry>& OutKills) const
+{
+	OutKills = Entries;
+	OutKills.Sort([](const FShooterKillFeedEntry& A, const FShooterKillFeedEntry& B) { return A.ServerTime > B.ServerTime; });
+}
+
+void FShooterKillFeed::Reset()
+{
+	Entries.Reset();
+	NextSlot = 0;
+	MarkArrayDirty();
+}
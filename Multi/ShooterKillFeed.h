@@ -0,0 +1,100 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "ShooterKillFeed.generated.h"
+
+class AShooterGameState;
+
+/**
+ *  One kill in the kill feed
+ */
+USTRUCT()
+struct MULTI_API FShooterKillFeedEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Player ID of the killer */
+	UPROPERTY()
+	int32 Killer = INDEX_NONE;
+
+	/** Player ID of the victim */
+	UPROPERTY()
+	int32 Victim = INDEX_NONE;
+
+	/** Kill feed ID of the weapon used */
+	UPROPERTY()
+	uint8 WeaponId = 0;
+
+	/** True if the killing blow was a headshot */
+	UPROPERTY()
+	bool bHeadshot = false;
+
+	/** Server time of the kill */
+	UPROPERTY()
+	float ServerTime = 0.0f;
+
+	/** Notifies the owner of a new kill. Kills from before this client joined aren't announced */
+	void PostReplicatedAdd(const struct FShooterKillFeed& InArraySerializer);
+	void PostReplicatedChange(const struct FShooterKillFeed& InArraySerializer);
+};
+
+/**
+ *  Fixed size ring buffer of the latest kills, delta replicated
+ *  Once full, the oldest slot is overwritten so a kill only costs one changed item
+ */
+USTRUCT()
+struct MULTI_API FShooterKillFeed : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/** Number of kills kept */
+	static constexpr int32 Capacity = 8;
+
+	/** Kill slots. Not in kill order once the buffer wraps */
+	UPROPERTY()
+	TArray<FShooterKillFeedEntry> Entries;
+
+	/** Game state that owns the kill feed */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<AShooterGameState> Owner;
+
+	/** Adds a kill, overwriting the oldest one when full. Server only */
+	void AddKill(int32 Killer, int32 Victim, uint8 WeaponId, bool bHeadshot, float ServerTime);
+
+	/** Returns the kills, newest first */
+	void GetKills(TArray<FShooterKillFeedEntry>& OutKills) const;
+
+	/** Clears the kill feed */
+	void Reset();
+
+	/** Sets the server time this client joined at. Kills before it are history and aren't announced */
+	void SetJoinServerTime(float InJoinServerTime) { JoinServerTime = InJoinServerTime; }
+
+	/** True if the kill happened after this client joined */
+	bool IsNewKill(const FShooterKillFeedEntry& Entry) const { return JoinServerTime >= 0.0f && Entry.ServerTime >= JoinServerTime; }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FShooterKillFeedEntry, FShooterKillFeed>(Entries, DeltaParms, *this);
+	}
+
+private:
+
+	/** Slot the next kill goes into once the buffer is full */
+	int32 NextSlot = 0;
+
+	/** Server time this client joined at. Negative until the game state begins play, so the initial history is never announced */
+	float JoinServerTime = -1.0f;
+};
+
+template<>
+struct TStructOpsTypeTraits<FShooterKillFeed> : public TStructOpsTypeTraitsBase2<FShooterKillFeed>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
@@ -0,0 +1,85 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterMapPreloadSubsystem.h"
+#include "Multi.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+void UShooterMapPreloadSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UShooterMapPreloadSubsystem::OnPostLoadMap);
+}
+
+void UShooterMapPreloadSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+	PreloadedWorld = nullptr;
+	PreloadPackageName = NAME_None;
+
+	Super::Deinitialize();
+}
+
+void UShooterMapPreloadSubsystem::PreloadMap(const FString& MapName)
+{
+	// travel URLs may carry options
+	FString PackageName = MapName;
+	PackageName.Split(TEXT("?"), &PackageName, nullptr);
+
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+	{
+		UE_LOG(LogMulti, Warning, TEXT("Can't preload map %s, it needs a long package name"), *MapName);
+		return;
+	}
+
+	// already loading or loaded
+	if (PreloadPackageName == FName(*PackageName))
+	{
+		return;
+	}
+
+	PreloadPackageName = FName(*PackageName);
+	PreloadedWorld = nullptr;
+
+	LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateUObject(this, &UShooterMapPreloadSubsystem::OnMapPreloaded));
+}
+
+bool UShooterMapPreloadSubsystem::IsMapPreloaded(const FString& MapName) const
+{
+	FString PackageName = MapName;
+	PackageName.Split(TEXT("?"), &PackageName, nullptr);
+
+	return PreloadedWorld && PreloadedWorld->GetOutermost()->GetFName() == FName(*PackageName);
+}
+
+void UShooterMapPreloadSubsystem::OnMapPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+	// a newer preload replaced this one
+	if (PackageName != PreloadPackageName)
+	{
+		return;
+	}
+
+	if (Result != EAsyncLoadingResult::Succeeded || !LoadedPackage)
+	{
+		UE_LOG(LogMulti, Warning, TEXT("Failed to preload map %s"), *PackageName.ToString());
+		PreloadPackageName = NAME_None;
+		return;
+	}
+
+	PreloadedWorld = UWorld::FindWorldInPackage(LoadedPackage);
+}
+
+void UShooterMapPreloadSubsystem::OnPostLoadMap(UWorld* LoadedWorld)
+{
+	// once the preloaded map is the current world, the engine owns it
+	if (LoadedWorld && LoadedWorld->GetOutermost()->GetFName() == PreloadPackageName)
+	{
+		PreloadedWorld = nullptr;
+		PreloadPackageName = NAME_None;
+	}
+}
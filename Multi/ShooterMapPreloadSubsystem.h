@@ -0,0 +1,52 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/UObjectGlobals.h"
+#include "ShooterMapPreloadSubsystem.generated.h"
+
+/**
+ *  Streams the next map in the background while the current match wraps up
+ *  Keeps the loaded map alive through the seamless travel transition so the travel itself doesn't hit the disk
+ */
+UCLASS()
+class MULTI_API UShooterMapPreloadSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Subscribes to map load notifications */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Releases the preloaded map */
+	virtual void Deinitialize() override;
+
+	/** Starts loading the given map package asynchronously */
+	void PreloadMap(const FString& MapName);
+
+	/** Returns true if the given map finished preloading */
+	bool IsMapPreloaded(const FString& MapName) const;
+
+protected:
+
+	/** Called when the async load of the map finishes */
+	void OnMapPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+
+	/** Releases the preloaded map once travel reaches it */
+	void OnPostLoadMap(UWorld* LoadedWorld);
+
+private:
+
+	/** Package name of the map being preloaded */
+	FName PreloadPackageName;
+
+	/** Preloaded map, kept referenced until we travel to it */
+	UPROPERTY()
+	TObjectPtr<UWorld> PreloadedWorld;
+
+	/** Handle to the map load notification */
+	FDelegateHandle PostLoadMapHandle;
+};
@@ -3,11 +3,11 @@
 
 #include "ShooterPlayerState.h"
 
-#include "ShooterBulletCounterUI.h"
+#include "ShooterHUDListener.h"
 #include "ShooterCharacter.h"
 #include "ShooterGameState.h"
 #include "ShooterPlayerController.h"
-#include "Kismet/GameplayStatics.h"
+#include "ShooterChatSubsystem.h"
 #include "Net/UnrealNetwork.h"
 
 AShooterPlayerState::AShooterPlayerState()
@@ -25,30 +25,34 @@ void AShooterPlayerState::AddToKillStreak()
 {
 	KillStreak++;
 
+	// Clients play the announcer from the replicated streak
+	if (AShooterGameState* GameState = GetWorld()->GetGameState<AShooterGameState>())
+	{
+		GameState->Scoreboard.SetStreak(this, KillStreak);
+	}
+
 	if (ShouldSendStreakAlert(KillStreak))
 	{
-		FString* MessagePtr = KillstreakMessages.Find(KillStreak);
-		
-		if (MessagePtr)
+		// Clients build the message from the same table
+		if (KillstreakMessages.Contains(KillStreak))
 		{
-			FString PlayerName = GetPlayerName();
-			FString AlertMessage = FString::Printf(TEXT("%s %s"), *PlayerName, **MessagePtr);
+			FShooterAlert Alert;
+			Alert.Type = EShooterAlert::KillStreak;
+			Alert.Player = GetPlayerId();
+			Alert.Count = static_cast<uint8>(FMath::Min(KillStreak, 255));
 
 			// Get team color
-			FLinearColor TeamColor = FLinearColor::White;
 			if (AShooterCharacter* Character = Cast<AShooterCharacter>(GetPawn()))
 			{
-				TeamColor = (Character->Team == EShooterTeam::Red) ? FLinearColor::Red : FLinearColor::Blue;
+				Alert.Color = (Character->Team == EShooterTeam::Red) ? EShooterAlertColor::Red : EShooterAlertColor::Blue;
 			}
             
 			// Send alert via GameState
 			if (AShooterGameState* GameState = GetWorld()->GetGameState<AShooterGameState>())
 			{
-				GameState->MulticastOnAlert(AlertMessage, TeamColor, 2.5f);
+				GameState->SendAlert(this, Alert);
 			}
 
-			MulticastPlayKillStreakSound(KillStreak);
-			
 			MarkStreakAlertSent(KillStreak);
 		}
 	}
@@ -58,6 +62,63 @@ void AShooterPlayerState::ResetKillStreak()
 {
 	KillStreak = 0;
 	SentStreakAlerts.Empty();
+
+	AShooterGameState* GameState = GetWorld()->GetGameState<AShooterGameState>();
+	if (GameState && HasAuthority())
+	{
+		GameState->Scoreboard.SetStreak(this, 0);
+	}
+}
+
+void AShooterPlayerState::Reset()
+{
+	Super::Reset();
+
+	ResetKillStreak();
+	OnRep_Score();
+
+	// everyone has to ready up again
+	bIsReady = false;
+}
+
+void AShooterPlayerState::OnRep_Score()
+{
+	Super::OnRep_Score();
+
+	OnHUDStateChanged.Broadcast();
+}
+
+void AShooterPlayerState::OnRep_ArenaIndex()
+{
+	OnHUDStateChanged.Broadcast();
+}
+
+void AShooterPlayerState::CopyProperties(APlayerState* PlayerState)
+{
+	Super::CopyProperties(PlayerState);
+
+	if (AShooterPlayerState* ShooterPS = Cast<AShooterPlayerState>(PlayerState))
+	{
+		ShooterPS->Team = Team;
+	}
+}
+
+void AShooterPlayerState::SeamlessTravelTo(APlayerState* NewPlayerState)
+{
+	Super::SeamlessTravelTo(NewPlayerState);
+
+	// the engine copies the score over, but team scores, the scoreboard and the kill feed all start at zero
+	NewPlayerState->SetScore(0.0f);
+}
+
+void AShooterPlayerState::OverrideWith(APlayerState* PlayerState)
+{
+	Super::OverrideWith(PlayerState);
+
+	if (AShooterPlayerState* ShooterPS = Cast<AShooterPlayerState>(PlayerState))
+	{
+		Team = ShooterPS->Team;
+	}
 }
 
 bool AShooterPlayerState::ShouldSendStreakAlert(int32 Streak) const
@@ -75,79 +136,43 @@ void AShooterPlayerState::MarkStreakAlertSent(int32 Streak)
 	SentStreakAlerts.AddUnique(Streak);
 }
 
-void AShooterPlayerState::ServerSendChatMessage_Implementation(EShooterTeam ChatTeam, const FString& SenderName,
-	const FString& Message)
+void AShooterPlayerState::ServerSendChatMessage_Implementation(bool bTeamOnly, const FString& Message)
 {
-	// Get the game state
-	if (AGameStateBase* GameState = GetWorld()->GetGameState())
+	// The chat subsystem routes, rate limits and batches the message
+	if (UShooterChatSubsystem* Chat = GetWorld()->GetSubsystem<UShooterChatSubsystem>())
 	{
-		// Loop through all the players
-		for (APlayerState* PlayerState : GameState->PlayerArray)
-		{
-			if (AShooterPlayerState* ShooterPS = Cast<AShooterPlayerState>(PlayerState))
-			{
-				// Determine if this player should receive the message
-				bool bShouldReceive = false;
-                
-				if (ChatTeam == EShooterTeam::None) // All chat
-				{
-					bShouldReceive = true; // Everyone gets all chat
-				}
-				else // Team chat
-				{
-					bShouldReceive = (ShooterPS->Team == ChatTeam); // Only same team gets team chat
-				}
-                
-				if (bShouldReceive)
-				{
-					ShooterPS->ClientReceiveChatMessage(ChatTeam, SenderName, Message);
-				}
-			}
-		}
-		
+		Chat->SendMessage(this, bTeamOnly, Message);
 	}
 }
 
-void AShooterPlayerState::MulticastPlayKillStreakSound_Implementation(int32 StreakCount)
+void AShooterPlayerState::ClientReceiveChatMessages_Implementation(const TArray<FShooterChatMessage>& Messages)
 {
-	if (USoundBase** Sound = KillStreakSounds.Find(StreakCount))
+	if (AShooterPlayerController* PC = Cast<AShooterPlayerController>(GetOwner()))
 	{
-		if (*Sound)
+		if (IShooterHUDListener* ShooterHUD = PC->GetShooterHUD())
 		{
-			UGameplayStatics::PlaySound2D(GetWorld(), *Sound);
+			for (const FShooterChatMessage& ChatMessage : Messages)
+			{
+				ShooterHUD->AddChatMessage(ChatMessage.ChatTeam, ChatMessage.SenderName, ChatMessage.Message);
+			}
 		}
 	}
 }
 
-void AShooterPlayerState::ClientReceiveChatMessage_Implementation(EShooterTeam ChatTeam, const FString& SenderName,
-	const FString& Message)
+void AShooterPlayerState::ServerSetReadyState_Implementation(bool bNewReady)
 {
-	if (AShooterPlayerController* PC = Cast<AShooterPlayerController>(GetOwner()))
+	// spectators don't take part in the ready check, and repeated calls change nothing
+	if (IsOnlyASpectator() || bIsReady == bNewReady)
 	{
-		if (PC->BulletCounterUI)
-		{
-			PC->BulletCounterUI->AddChatMessage(ChatTeam, SenderName, Message);
-		}
+		return;
 	}
-}
 
-void AShooterPlayerState::ServerSetReadyState_Implementation(bool bIsReady)
-{
-	// Get the game state
+	bIsReady = bNewReady;
+
+	// Start or cancel the countdown
 	if (AShooterGameState* GameState = GetWorld()->GetGameState<AShooterGameState>())
 	{
-		if (bIsReady)
-		{
-			// Player is checking ready
-			GameState->PlayersReady++;
-		}
-		else
-		{
-			// Player is unchecking ready
-			GameState->PlayersReady--;
-			// Do not go below 0
-			GameState->PlayersReady = FMath::Max(0, GameState->PlayersReady);
-		}
+		GameState->UpdateMatchCountdown();
 	}
 }
 
@@ -156,4 +181,6 @@ void AShooterPlayerState::GetLifetimeReplicatedProps(TArray<class FLifetimePrope
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(AShooterPlayerState, Team);
+	DOREPLIFETIME(AShooterPlayerState, bIsReady);
+	DOREPLIFETIME(AShooterPlayerState, ArenaIndex);
 }
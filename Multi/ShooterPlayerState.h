@@ -21,6 +21,26 @@ enum class EShooterTeam : uint8
 	Blue
 };
 
+/**
+ *  A chat message as received by clients
+ */
+USTRUCT()
+struct FShooterChatMessage
+{
+	GENERATED_BODY()
+
+	/** Team the message was sent to, or None for all chat */
+	UPROPERTY()
+	EShooterTeam ChatTeam = EShooterTeam::None;
+
+	/** Name of the sender, filled in by the server */
+	UPROPERTY()
+	FString SenderName;
+
+	UPROPERTY()
+	FString Message;
+};
+
 UCLASS()
 class MULTI_API AShooterPlayerState : public APlayerState
 {
@@ -34,6 +54,24 @@ public:
 	UPROPERTY(Replicated)
 	EShooterTeam Team = EShooterTeam::None;
 
+	/** True once the player checked ready for the next match */
+	UPROPERTY(Replicated)
+	bool bIsReady = false;
+
+	/** Arena the player plays in, or INDEX_NONE when the level has no arenas */
+	UPROPERTY(ReplicatedUsing = OnRep_ArenaIndex)
+	int32 ArenaIndex = INDEX_NONE;
+
+	/** Called when the score or arena change */
+	FSimpleMulticastDelegate OnHUDStateChanged;
+
+	/** Updates the HUD. Call on the server after changing the score */
+	virtual void OnRep_Score() override;
+
+	/** Updates the HUD. Call on the server after changing the arena */
+	UFUNCTION()
+	void OnRep_ArenaIndex();
+
 	//** Get the current kill streak */
 	int32 GetKillStreak() const { return KillStreak; }
 
@@ -47,17 +85,30 @@ public:
 
 	void MarkStreakAlertSent(int32 Streak);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastPlayKillStreakSound(int32 StreakCount);
 	
+	/** Sends a chat message from this player to all chat or to their team */
 	UFUNCTION(Server, Reliable)
-    void ServerSendChatMessage(EShooterTeam ChatTeam, const FString& SenderName, const FString& Message);
-    
-    UFUNCTION(Client, Reliable)
-    void ClientReceiveChatMessage(EShooterTeam ChatTeam, const FString& SenderName, const FString& Message);
+	void ServerSendChatMessage(bool bTeamOnly, const FString& Message);
 
+	/** Receives the chat messages sent to this player in a frame */
+	UFUNCTION(Client, Reliable)
+	void ClientReceiveChatMessages(const TArray<FShooterChatMessage>& Messages);
+
+	/** Sets whether the player is ready for the next match */
 	UFUNCTION(Server, Reliable)
-	void ServerSetReadyState (bool bIsReady);
+	void ServerSetReadyState(bool bNewReady);
+
+	/** Clears the score and kill streak for a soft match reset */
+	virtual void Reset() override;
+
+	/** Carries the team over to the new player state on seamless travel */
+	virtual void CopyProperties(APlayerState* PlayerState) override;
+
+	/** Starts the next match of the rotation with a clean score, like a soft reset does */
+	virtual void SeamlessTravelTo(APlayerState* NewPlayerState) override;
+
+	/** Restores the team from an inactive player state when reconnecting */
+	virtual void OverrideWith(APlayerState* PlayerState) override;
 
 	UPROPERTY(EditDefaultsOnly)
 	TMap<int32, FString> KillstreakMessages;
@@ -71,8 +122,5 @@ protected:
 
 	UPROPERTY()
 	TArray<int32> SentStreakAlerts;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
-	TMap<int32, USoundBase*> KillStreakSounds;	
 	
 };
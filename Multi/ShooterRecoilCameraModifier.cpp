@@ -0,0 +1,22 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterRecoilCameraModifier.h"
+
+void UShooterRecoilCameraModifier::AddPunch(const FRotator& Punch)
+{
+	PunchOffset += Punch * PunchScale;
+}
+
+bool UShooterRecoilCameraModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo& InOutPOV)
+{
+	Super::ModifyCamera(DeltaTime, InOutPOV);
+
+	// recover towards no punch
+	PunchOffset = FMath::RInterpTo(PunchOffset, FRotator::ZeroRotator, DeltaTime, RecoverySpeed);
+
+	InOutPOV.Rotation += PunchOffset;
+
+	// allow other modifiers to run
+	return false;
+}
@@ -0,0 +1,40 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/CameraModifier.h"
+#include "ShooterRecoilCameraModifier.generated.h"
+
+/**
+ *  Adds a short visual punch to the view on every recoil kick
+ *  The punch recovers on its own and never changes the aim
+ */
+UCLASS()
+class MULTI_API UShooterRecoilCameraModifier : public UCameraModifier
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds a punch to the current view offset */
+	void AddPunch(const FRotator& Punch);
+
+protected:
+
+	/** Fraction of the recoil kick shown as visual punch */
+	UPROPERTY(EditAnywhere, Category="Recoil", meta = (ClampMin = 0, ClampMax = 2))
+	float PunchScale = 0.5f;
+
+	/** Speed at which the punch recovers */
+	UPROPERTY(EditAnywhere, Category="Recoil", meta = (ClampMin = 0))
+	float RecoverySpeed = 12.0f;
+
+	/** Applies the punch to the view */
+	virtual bool ModifyCamera(float DeltaTime, FMinimalViewInfo& InOutPOV) override;
+
+private:
+
+	/** Current punch offset */
+	FRotator PunchOffset = FRotator::ZeroRotator;
+};
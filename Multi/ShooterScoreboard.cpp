@@ -0,0 +1,166 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterScoreboard.h"
+#include "ShooterGameState.h"
+#include "GameFramework/PlayerState.h"
+
+void FShooterScoreboardEntry::PostReplicatedAdd(const FShooterScoreboard& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnScoreboardChanged.Broadcast(*this);
+	}
+}
+
+void FShooterScoreboardEntry::PostReplicatedChange(const FShooterScoreboard& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnScoreboardChanged.Broadcast(*this);
+	}
+}
+
+void FShooterScoreboardEntry::PreReplicatedRemove(const FShooterScoreboard& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnScoreboardChanged.Broadcast(*this);
+	}
+}
+
+void FShooterScoreboard::AddPlayer(const APlayerState* PlayerState)
+{
+	if (!PlayerState || FindEntry(PlayerState->GetPlayerId()))
+	{
+		return;
+	}
+
+	FShooterScoreboardEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.PlayerId = PlayerState->GetPlayerId();
+	MarkEntryDirty(Entry);
+}
+
+void FShooterScoreboard::RemovePlayer(const APlayerState* PlayerState)
+{
+	if (!PlayerState)
+	{
+		return;
+	}
+
+	const int32 PlayerId = PlayerState->GetPlayerId();
+	if (Entries.RemoveAll([PlayerId](const FShooterScoreboardEntry& Entry) { return Entry.PlayerId == PlayerId; }) > 0)
+	{
+		MarkArrayDirty();
+	}
+}
+
+const FShooterScoreboardEntry* FShooterScoreboard::FindEntry(int32 PlayerId) const
+{
+	return Entries.FindByPredicate([PlayerId](const FShooterScoreboardEntry& Entry) { return Entry.PlayerId == PlayerId; });
+}
+
+void FShooterScoreboard::AddKill(const APlayerState* PlayerState)
+{
+	if (FShooterScoreboardEntry* Entry = FindEntryMutable(PlayerState))
+	{
+		Entry->Kills++;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FShooterScoreboard::AddDeath(const APlayerState* PlayerState)
+{
+	if (FShooterScoreboardEntry* Entry = FindEntryMutable(PlayerState))
+	{
+		Entry->Deaths++;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FShooterScoreboard::AddAssist(const APlayerState* PlayerState)
+{
+	if (FShooterScoreboardEntry* Entry = FindEntryMutable(PlayerState))
+	{
+		Entry->Assists++;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FShooterScoreboard::SetStreak(const APlayerState* PlayerState, int32 Streak)
+{
+	const uint8 NewStreak = static_cast<uint8>(FMath::Clamp(Streak, 0, 255));
+
+	FShooterScoreboardEntry* Entry = FindEntryMutable(PlayerState);
+	if (Entry && Entry->Streak != NewStreak)
+	{
+		Entry->Streak = NewStreak;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FShooterScoreboard::UpdatePings(const TArray<TObjectPtr<APlayerState>>& PlayerArray)
+{
+	for (const APlayerState* PlayerState : PlayerArray)
+	{
+		FShooterScoreboardEntry* Entry = FindEntryMutable(PlayerState);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		// small ping jitter stays within a bucket and doesn't cost bandwidth
+		const uint8 NewBucket = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(PlayerState->GetPingInMilliseconds()) / PingBucketSize, 0, 255));
+		if (Entry->PingBucket != NewBucket)
+		{
+			Entry->PingBucket = NewBucket;
+			MarkEntryDirty(*Entry);
+		}
+	}
+}
+
+void FShooterScoreboard::ResetPlayer(const APlayerState* PlayerState)
+{
+	if (FShooterScoreboardEntry* Entry = FindEntryMutable(PlayerState))
+	{
+		Entry->Kills = 0;
+		Entry->Deaths = 0;
+		Entry->Assists = 0;
+		Entry->Streak = 0;
+		MarkEntryDirty(*Entry);
+	}
+}
+
+void FShooterScoreboard::ResetAll()
+{
+	for (FShooterScoreboardEntry& Entry : Entries)
+	{
+		Entry.Kills = 0;
+		Entry.Deaths = 0;
+		Entry.Assists = 0;
+		Entry.Streak = 0;
+		MarkEntryDirty(Entry);
+	}
+}
+
+void FShooterScoreboard::MarkEntryDirty(FShooterScoreboardEntry& Entry)
+{
+	MarkItemDirty(Entry);
+
+	// the server doesn't get replication callbacks, let local listeners know too
+	if (Owner)
+	{
+		Owner->OnScoreboardChanged.Broadcast(Entry);
+	}
+}
+
+FShooterScoreboardEntry* FShooterScoreboard::FindEntryMutable(const APlayerState* PlayerState)
+{
+	if (!PlayerState)
+	{
+		return nullptr;
+	}
+
+	const int32 PlayerId = PlayerState->GetPlayerId();
+	return Entries.FindByPredicate([PlayerId](const FShooterScoreboardEntry& Entry) { return Entry.PlayerId == PlayerId; });
+}
@@ -0,0 +1,121 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "ShooterScoreboard.generated.h"
+
+class AShooterGameState;
+class APlayerState;
+
+/**
+ *  One player's row on the scoreboard
+ */
+USTRUCT()
+struct MULTI_API FShooterScoreboardEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Player this row belongs to, by player ID */
+	UPROPERTY()
+	int32 PlayerId = INDEX_NONE;
+
+	/** Kills this match */
+	UPROPERTY()
+	uint16 Kills = 0;
+
+	/** Deaths this match */
+	UPROPERTY()
+	uint16 Deaths = 0;
+
+	/** Kills this player helped with */
+	UPROPERTY()
+	uint16 Assists = 0;
+
+	/** Current kill streak */
+	UPROPERTY()
+	uint8 Streak = 0;
+
+	/** Ping in buckets of PingBucketSize milliseconds */
+	UPROPERTY()
+	uint8 PingBucket = 0;
+
+	/** Notifies the owner that the scoreboard changed */
+	void PostReplicatedAdd(const struct FShooterScoreboard& InArraySerializer);
+	void PostReplicatedChange(const struct FShooterScoreboard& InArraySerializer);
+	void PreReplicatedRemove(const struct FShooterScoreboard& InArraySerializer);
+};
+
+/**
+ *  Delta replicated scoreboard. Only rows that changed are sent
+ *  Server side, every change goes through one of the helpers below so rows are marked dirty
+ */
+USTRUCT()
+struct MULTI_API FShooterScoreboard : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/** Milliseconds per ping bucket */
+	static constexpr int32 PingBucketSize = 20;
+
+	/** One row per player */
+	UPROPERTY()
+	TArray<FShooterScoreboardEntry> Entries;
+
+	/** Game state that owns the scoreboard */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<AShooterGameState> Owner;
+
+	/** Adds a row for the player */
+	void AddPlayer(const APlayerState* PlayerState);
+
+	/** Removes the player's row */
+	void RemovePlayer(const APlayerState* PlayerState);
+
+	/** Returns the player's row, if any */
+	const FShooterScoreboardEntry* FindEntry(int32 PlayerId) const;
+
+	/** Adds a kill to the player's row */
+	void AddKill(const APlayerState* PlayerState);
+
+	/** Adds a death to the player's row */
+	void AddDeath(const APlayerState* PlayerState);
+
+	/** Adds an assist to the player's row */
+	void AddAssist(const APlayerState* PlayerState);
+
+	/** Sets the player's current kill streak */
+	void SetStreak(const APlayerState* PlayerState, int32 Streak);
+
+	/** Refreshes the ping buckets, only dirtying rows whose bucket changed */
+	void UpdatePings(const TArray<TObjectPtr<APlayerState>>& PlayerArray);
+
+	/** Clears the player's stats */
+	void ResetPlayer(const APlayerState* PlayerState);
+
+	/** Clears every player's stats */
+	void ResetAll();
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FShooterScoreboardEntry, FShooterScoreboard>(Entries, DeltaParms, *this);
+	}
+
+private:
+
+	/** Returns the player's row for editing */
+	FShooterScoreboardEntry* FindEntryMutable(const APlayerState* PlayerState);
+
+	/** Marks the row for replication and notifies the owner */
+	void MarkEntryDirty(FShooterScoreboardEntry& Entry);
+};
+
+template<>
+struct TStructOpsTypeTraits<FShooterScoreboard> : public TStructOpsTypeTraitsBase2<FShooterScoreboard>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
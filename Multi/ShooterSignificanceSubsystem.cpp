@@ -0,0 +1,271 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterSignificanceSubsystem.h"
+#include "ShooterWeapon.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+UShooterSignificanceSubsystem::UShooterSignificanceSubsystem()
+{
+	// default buckets, can be overridden from DefaultGame.ini
+	auto AddBucket = [this](float MinSignificance, float TickInterval, int32 AnimFrameSkip, bool bTickWeapons)
+	{
+		FShooterSignificanceBucket& Bucket = Buckets.AddDefaulted_GetRef();
+		Bucket.MinSignificance = MinSignificance;
+		Bucket.TickInterval = TickInterval;
+		Bucket.AnimFrameSkip = AnimFrameSkip;
+		Bucket.bTickWeapons = bTickWeapons;
+	};
+
+	AddBucket(0.75f, 0.0f, 0, true);
+	AddBucket(0.4f, 0.033f, 1, true);
+	AddBucket(0.15f, 0.1f, 3, false);
+	AddBucket(0.0f, 0.25f, 8, false);
+}
+
+void UShooterSignificanceSubsystem::RegisterPawn(ACharacter* Pawn)
+{
+	if (!Pawn || FindEntry(Pawn))
+	{
+		return;
+	}
+
+	FPawnSignificance& Entry = Pawns.AddDefaulted_GetRef();
+	Entry.Pawn = Pawn;
+
+	// force an update soon so new pawns don't run at full rate for long
+	TimeSinceUpdate = UpdateInterval;
+}
+
+void UShooterSignificanceSubsystem::UnregisterPawn(ACharacter* Pawn)
+{
+	for (int32 i = Pawns.Num() - 1; i >= 0; i--)
+	{
+		if (Pawns[i].Pawn.Get() == Pawn)
+		{
+			// restore full rate settings in case the pawn outlives its registration
+			if (IsValid(Pawn))
+			{
+				ApplyBucket(Pawn, FShooterSignificanceBucket());
+			}
+
+			Pawns.RemoveAtSwap(i);
+		}
+	}
+}
+
+void UShooterSignificanceSubsystem::ReportCombat(ACharacter* Pawn)
+{
+	if (FPawnSignificance* Entry = FindEntry(Pawn))
+	{
+		Entry->LastCombatTime = GetWorld()->GetTimeSeconds();
+
+		// promote the pawn right away instead of waiting for the next update
+		const int32 TopBucket = FindBucket(1.0f);
+		if (Entry->BucketIndex != TopBucket && Buckets.IsValidIndex(TopBucket))
+		{
+			Entry->Significance = 1.0f;
+			Entry->BucketIndex = TopBucket;
+			ApplyBucket(Pawn, Buckets[TopBucket]);
+		}
+	}
+}
+
+float UShooterSignificanceSubsystem::GetSignificance(const ACharacter* Pawn) const
+{
+	const FPawnSignificance* Entry = FindEntry(Pawn);
+	return Entry ? Entry->Significance : 1.0f;
+}
+
+void UShooterSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceUpdate += DeltaTime;
+
+	if (TimeSinceUpdate < UpdateInterval || Buckets.Num() == 0)
+	{
+		return;
+	}
+
+	TimeSinceUpdate = 0.0f;
+
+	UWorld* World = GetWorld();
+	const float Now = World->GetTimeSeconds();
+
+	// gather the viewpoints of every player this instance serves
+	// clients only know their local controllers, servers know all of them
+	TArray<FTransform> Viewpoints;
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (APlayerController* PC = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+			Viewpoints.Emplace(ViewRotation, ViewLocation);
+		}
+	}
+
+	for (int32 i = Pawns.Num() - 1; i >= 0; i--)
+	{
+		FPawnSignificance& Entry = Pawns[i];
+		ACharacter* Pawn = Entry.Pawn.Get();
+
+		// drop pawns that were destroyed without unregistering
+		if (!IsValid(Pawn))
+		{
+			Pawns.RemoveAtSwap(i);
+			continue;
+		}
+
+		Entry.Significance = CalculateSignificance(Entry, Viewpoints, Now);
+
+		// only touch the pawn when it changes buckets
+		const int32 NewBucket = FindBucket(Entry.Significance);
+		if (NewBucket != Entry.BucketIndex)
+		{
+			Entry.BucketIndex = NewBucket;
+			ApplyBucket(Pawn, Buckets[NewBucket]);
+		}
+	}
+}
+
+TStatId UShooterSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UShooterSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+float UShooterSignificanceSubsystem::CalculateSignificance(const FPawnSignificance& Entry, const TArray<FTransform>& Viewpoints, float Now) const
+{
+	const ACharacter* Pawn = Entry.Pawn.Get();
+
+	// our own pawn is always fully significant
+	if (Pawn->IsLocallyControlled() && Pawn->IsPlayerControlled())
+	{
+		return 1.0f;
+	}
+
+	// with no viewers there's nothing to prioritize against
+	if (Viewpoints.Num() == 0)
+	{
+		return 1.0f;
+	}
+
+	const FVector PawnLocation = Pawn->GetActorLocation();
+	const float ConeCos = FMath::Cos(FMath::DegreesToRadians(ViewConeHalfAngle));
+
+	// keep the best score across all viewers
+	float BestScore = 0.0f;
+
+	for (const FTransform& View : Viewpoints)
+	{
+		const FVector ToPawn = PawnLocation - View.GetLocation();
+		const float Distance = ToPawn.Size();
+
+		float Score = 1.0f - FMath::Clamp(Distance / MaxSignificanceDistance, 0.0f, 1.0f);
+
+		// scale down pawns outside of the view cone
+		const FVector ViewDir = View.GetRotation().GetForwardVector();
+		if (FVector::DotProduct(ViewDir, ToPawn.GetSafeNormal()) < ConeCos)
+		{
+			Score *= OffscreenScale;
+		}
+
+		BestScore = FMath::Max(BestScore, Score);
+	}
+
+	// boost pawns that recently fired or took damage
+	if (Now - Entry.LastCombatTime <= CombatWindow)
+	{
+		BestScore += CombatBonus;
+	}
+
+	return FMath::Clamp(BestScore, 0.0f, 1.0f);
+}
+
+int32 UShooterSignificanceSubsystem::FindBucket(float Significance) const
+{
+	for (int32 i = 0; i < Buckets.Num(); i++)
+	{
+		if (Significance >= Buckets[i].MinSignificance)
+		{
+			return i;
+		}
+	}
+
+	// fall back to the least significant bucket
+	return Buckets.Num() - 1;
+}
+
+void UShooterSignificanceSubsystem::ApplyBucket(ACharacter* Pawn, const FShooterSignificanceBucket& Bucket) const
+{
+	// helper to apply the anim update rate to a skeletal mesh through its LOD frame skip map
+	auto ApplyAnimRate = [&Bucket](USkeletalMeshComponent* Mesh)
+	{
+		Mesh->bEnableUpdateRateOptimizations = true;
+
+		if (FAnimUpdateRateParameters* Params = Mesh->AnimUpdateRateParams)
+		{
+			Params->bShouldUseLODMap = true;
+			Params->LODToFrameSkipMap.Reset();
+
+			for (int32 LOD = 0; LOD < MAX_MESH_LOD_COUNT; LOD++)
+			{
+				Params->LODToFrameSkipMap.Add(LOD, Bucket.AnimFrameSkip);
+			}
+		}
+	};
+
+	Pawn->SetActorTickInterval(Bucket.TickInterval);
+
+	// only throttle movement on simulated proxies. Authority and autonomous movement must stay exact
+	if (Pawn->GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		Pawn->GetCharacterMovement()->SetComponentTickInterval(Bucket.TickInterval);
+	}
+
+	TArray<USkeletalMeshComponent*> Meshes;
+	Pawn->GetComponents<USkeletalMeshComponent>(Meshes);
+
+	for (USkeletalMeshComponent* Mesh : Meshes)
+	{
+		ApplyAnimRate(Mesh);
+	}
+
+	// apply to any weapons held by the pawn
+	TArray<AActor*> AttachedActors;
+	Pawn->GetAttachedActors(AttachedActors);
+
+	for (AActor* Attached : AttachedActors)
+	{
+		if (AShooterWeapon* Weapon = Cast<AShooterWeapon>(Attached))
+		{
+			Weapon->SetActorTickEnabled(Bucket.bTickWeapons);
+
+			ApplyAnimRate(Weapon->GetFirstPersonMesh());
+			ApplyAnimRate(Weapon->GetThirdPersonMesh());
+		}
+	}
+}
+
+UShooterSignificanceSubsystem::FPawnSignificance* UShooterSignificanceSubsystem::FindEntry(const ACharacter* Pawn)
+{
+	return Pawns.FindByPredicate([Pawn](const FPawnSignificance& Entry) { return Entry.Pawn.Get() == Pawn; });
+}
+
+const UShooterSignificanceSubsystem::FPawnSignificance* UShooterSignificanceSubsystem::FindEntry(const ACharacter* Pawn) const
+{
+	return Pawns.FindByPredicate([Pawn](const FPawnSignificance& Entry) { return Entry.Pawn.Get() == Pawn; });
+}
@@ -0,0 +1,130 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterSignificanceSubsystem.generated.h"
+
+class ACharacter;
+
+/**
+ *  Tick and animation settings applied to pawns whose significance falls in this bucket
+ */
+USTRUCT(BlueprintType)
+struct FShooterSignificanceBucket
+{
+	GENERATED_BODY()
+
+	/** Lowest significance (0-1) that still falls in this bucket */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 1))
+	float MinSignificance = 0.0f;
+
+	/** Actor and movement tick interval. 0 ticks every frame */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 1, Units = "s"))
+	float TickInterval = 0.0f;
+
+	/** Number of frames skipped between animation updates (URO). 0 updates every frame */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 30))
+	int32 AnimFrameSkip = 0;
+
+	/** If false, weapons attached to the pawn stop ticking */
+	UPROPERTY(EditAnywhere, Config, Category="Significance")
+	bool bTickWeapons = true;
+};
+
+/**
+ *  Scores shooter pawns by distance, view cone and recent combat
+ *  Drives tick intervals, animation update rates and weapon ticking from the score
+ *  Locally controlled pawns are always fully significant
+ */
+UCLASS(Config=Game)
+class MULTI_API UShooterSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UShooterSignificanceSubsystem();
+
+	/** Adds a pawn to the significance list */
+	void RegisterPawn(ACharacter* Pawn);
+
+	/** Removes a pawn from the significance list and restores its full rate settings */
+	void UnregisterPawn(ACharacter* Pawn);
+
+	/** Flags a pawn as being in combat so it stays significant for a while */
+	void ReportCombat(ACharacter* Pawn);
+
+	/** Returns the last computed significance for the pawn, or 1 if it's not registered */
+	float GetSignificance(const ACharacter* Pawn) const;
+
+	//~Begin FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End FTickableGameObject interface
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Buckets ordered from most to least significant */
+	UPROPERTY(EditAnywhere, Config, Category="Significance")
+	TArray<FShooterSignificanceBucket> Buckets;
+
+	/** Time between significance updates */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 2, Units = "s"))
+	float UpdateInterval = 0.25f;
+
+	/** Distance at which the distance score reaches zero */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, Units = "cm"))
+	float MaxSignificanceDistance = 8000.0f;
+
+	/** Half-angle of the view cone considered on screen */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 180, Units = "Degrees"))
+	float ViewConeHalfAngle = 60.0f;
+
+	/** Multiplier applied to the distance score of pawns outside every view cone */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 1))
+	float OffscreenScale = 0.35f;
+
+	/** Time a pawn stays boosted after firing or being hit */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, Units = "s"))
+	float CombatWindow = 3.0f;
+
+	/** Significance added to pawns that were recently in combat */
+	UPROPERTY(EditAnywhere, Config, Category="Significance", meta = (ClampMin = 0, ClampMax = 1))
+	float CombatBonus = 0.4f;
+
+private:
+
+	/** Per pawn significance bookkeeping */
+	struct FPawnSignificance
+	{
+		TWeakObjectPtr<ACharacter> Pawn;
+		float Significance = 1.0f;
+		float LastCombatTime = -BIG_NUMBER;
+		int32 BucketIndex = INDEX_NONE;
+	};
+
+	/** Registered pawns */
+	TArray<FPawnSignificance> Pawns;
+
+	/** Time accumulated since the last update */
+	float TimeSinceUpdate = 0.0f;
+
+	/** Scores a pawn against the gathered viewpoints */
+	float CalculateSignificance(const FPawnSignificance& Entry, const TArray<FTransform>& Viewpoints, float Now) const;
+
+	/** Returns the bucket index for the given significance */
+	int32 FindBucket(float Significance) const;
+
+	/** Applies the bucket settings to the pawn, its movement, meshes and weapons */
+	void ApplyBucket(ACharacter* Pawn, const FShooterSignificanceBucket& Bucket) const;
+
+	/** Finds a registered pawn entry */
+	FPawnSignificance* FindEntry(const ACharacter* Pawn);
+	const FPawnSignificance* FindEntry(const ACharacter* Pawn) const;
+};
@@ -0,0 +1,180 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterSpawnRegistrySubsystem.h"
+#include "ShooterCharacter.h"
+#include "EngineUtils.h"
+#include "Engine/PlayerStartPIE.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+
+void UShooterSpawnRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	StartsByTag.Reset();
+	FitCache.Reset();
+	PlayInEditorStart = nullptr;
+
+	// player starts don't move, so walk them once
+	for (TActorIterator<APlayerStart> It(&InWorld); It; ++It)
+	{
+		APlayerStart* PlayerStart = *It;
+
+		if (PlayerStart->IsA<APlayerStartPIE>())
+		{
+			// Always prefer the first "Play from Here" PlayerStart, if we find one while in PIE mode
+			if (!PlayInEditorStart)
+			{
+				PlayInEditorStart = PlayerStart;
+			}
+			continue;
+		}
+
+		StartsByTag.FindOrAdd(PlayerStart->PlayerStartTag).Starts.Add(PlayerStart);
+	}
+}
+
+void UShooterSpawnRegistrySubsystem::RegisterCharacter(AShooterCharacter* Character)
+{
+	Characters.AddUnique(Character);
+
+	// a new character must be visible to spawns later this frame
+	GridFrame = MAX_uint64;
+}
+
+void UShooterSpawnRegistrySubsystem::UnregisterCharacter(AShooterCharacter* Character)
+{
+	Characters.RemoveSwap(Character);
+
+	GridFrame = MAX_uint64;
+}
+
+const TArray<TObjectPtr<APlayerStart>>& UShooterSpawnRegistrySubsystem::GetStartsWithTag(FName Tag) const
+{
+	static const TArray<TObjectPtr<APlayerStart>> NoStarts;
+
+	const FShooterPlayerStartList* List = StartsByTag.Find(Tag);
+	return List ? List->Starts : NoStarts;
+}
+
+EShooterStartFit UShooterSpawnRegistrySubsystem::GetStartFit(APlayerStart* Start, const APawn* PawnToFit)
+{
+	// nearby characters can block the start, so skip the cache while any are around
+	const bool bOccupied = AnyCharacterWithinRadius(Start->GetActorLocation(), OccupancyRadius, [](const AShooterCharacter*) { return true; });
+
+	if (bOccupied)
+	{
+		return ComputeStartFit(Start, PawnToFit);
+	}
+
+	UClass* PawnClass = PawnToFit ? PawnToFit->GetClass() : nullptr;
+
+	FStartFitCache& Cached = FitCache.FindOrAdd(Start);
+	if (Cached.PawnClass.Get() != PawnClass || !Cached.PawnClass.IsValid())
+	{
+		// only static geometry is around, so this result stays valid until pawns show up
+		Cached.Fit = ComputeStartFit(Start, PawnToFit);
+		Cached.PawnClass = PawnClass;
+	}
+
+	return Cached.Fit;
+}
+
+bool UShooterSpawnRegistrySubsystem::IsEnemyWithinRadius(const FVector& Location, EShooterTeam Team, float Radius)
+{
+	return AnyCharacterWithinRadius(Location, Radius, [Team](const AShooterCharacter* Character)
+	{
+		return Character->Team != Team && Character->Team != EShooterTeam::None;
+	});
+}
+
+bool UShooterSpawnRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShooterSpawnRegistrySubsystem::UpdateGrid()
+{
+	if (GridFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	GridFrame = GFrameCounter;
+
+	// keep the cell arrays allocated between rebuilds
+	for (TPair<FIntPoint, TArray<AShooterCharacter*>>& Cell : Grid)
+	{
+		Cell.Value.Reset();
+	}
+
+	for (int32 i = Characters.Num() - 1; i >= 0; i--)
+	{
+		AShooterCharacter* Character = Characters[i].Get();
+
+		if (!IsValid(Character))
+		{
+			Characters.RemoveAtSwap(i);
+			continue;
+		}
+
+		Grid.FindOrAdd(GetCell(Character->GetActorLocation())).Add(Character);
+	}
+}
+
+FIntPoint UShooterSpawnRegistrySubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / GridCellSize), FMath::FloorToInt(Location.Y / GridCellSize));
+}
+
+bool UShooterSpawnRegistrySubsystem::AnyCharacterWithinRadius(const FVector& Location, float Radius, TFunctionRef<bool(const AShooterCharacter*)> Filter)
+{
+	UpdateGrid();
+
+	const FIntPoint Center = GetCell(Location);
+	const int32 CellRange = FMath::Max(1, FMath::CeilToInt(Radius / GridCellSize));
+	const float RadiusSquared = FMath::Square(Radius);
+
+	for (int32 X = Center.X - CellRange; X <= Center.X + CellRange; X++)
+	{
+		for (int32 Y = Center.Y - CellRange; Y <= Center.Y + CellRange; Y++)
+		{
+			const TArray<AShooterCharacter*>* Cell = Grid.Find(FIntPoint(X, Y));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const AShooterCharacter* Character : *Cell)
+			{
+				if (Filter(Character) && FVector::DistSquared(Location, Character->GetActorLocation()) <= RadiusSquared)
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+EShooterStartFit UShooterSpawnRegistrySubsystem::ComputeStartFit(APlayerStart* Start, const APawn* PawnToFit) const
+{
+	UWorld* World = GetWorld();
+
+	FVector ActorLocation = Start->GetActorLocation();
+	const FRotator ActorRotation = Start->GetActorRotation();
+
+	if (!World->EncroachingBlockingGeometry(PawnToFit, ActorLocation, ActorRotation))
+	{
+		return EShooterStartFit::Free;
+	}
+
+	if (World->FindTeleportSpot(PawnToFit, ActorLocation, ActorRotation))
+	{
+		return EShooterStartFit::Teleport;
+	}
+
+	return EShooterStartFit::Blocked;
+}
@@ -0,0 +1,124 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShooterPlayerState.h"
+#include "ShooterSpawnRegistrySubsystem.generated.h"
+
+class APlayerStart;
+class AShooterCharacter;
+
+/**
+ *  How well a pawn fits at a player start
+ */
+enum class EShooterStartFit : uint8
+{
+	/* The pawn fits at the start as is */
+	Free,
+	/* The pawn fits after being nudged to a nearby spot */
+	Teleport,
+	/* The pawn doesn't fit */
+	Blocked
+};
+
+/**
+ *  List of player starts sharing a tag
+ */
+USTRUCT()
+struct FShooterPlayerStartList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<APlayerStart>> Starts;
+};
+
+/**
+ *  Caches player starts per team tag and answers spawn safety queries
+ *  Encroachment results are cached per start and only recomputed while pawns are near the start
+ *  Enemy proximity queries use a uniform grid of character positions, rebuilt at most once per frame
+ */
+UCLASS()
+class MULTI_API UShooterSpawnRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Caches the player starts in the level */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Adds a character to the position grid */
+	void RegisterCharacter(AShooterCharacter* Character);
+
+	/** Removes a character from the position grid */
+	void UnregisterCharacter(AShooterCharacter* Character);
+
+	/** Returns the starts with the given tag */
+	const TArray<TObjectPtr<APlayerStart>>& GetStartsWithTag(FName Tag) const;
+
+	/** Returns the "Play from Here" start, if any */
+	APlayerStart* GetPlayInEditorStart() const { return PlayInEditorStart; }
+
+	/** Returns how the pawn fits at the start, using the cache when no pawns are nearby */
+	EShooterStartFit GetStartFit(APlayerStart* Start, const APawn* PawnToFit);
+
+	/** Returns true if a character not on the given team is within the radius of the location */
+	bool IsEnemyWithinRadius(const FVector& Location, EShooterTeam Team, float Radius);
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Size of a grid cell. Queries up to this radius only touch the neighboring cells */
+	UPROPERTY(EditAnywhere, Category="Spawn")
+	float GridCellSize = 1000.0f;
+
+	/** Characters closer than this to a start invalidate its cached fit */
+	UPROPERTY(EditAnywhere, Category="Spawn")
+	float OccupancyRadius = 200.0f;
+
+private:
+
+	/** Cached fit for a start */
+	struct FStartFitCache
+	{
+		EShooterStartFit Fit = EShooterStartFit::Blocked;
+		TWeakObjectPtr<UClass> PawnClass;
+	};
+
+	/** Starts by tag */
+	UPROPERTY()
+	TMap<FName, FShooterPlayerStartList> StartsByTag;
+
+	/** "Play from Here" start */
+	UPROPERTY()
+	TObjectPtr<APlayerStart> PlayInEditorStart;
+
+	/** Fit computed with no pawns nearby, by start */
+	TMap<TWeakObjectPtr<APlayerStart>, FStartFitCache> FitCache;
+
+	/** Registered characters */
+	TArray<TWeakObjectPtr<AShooterCharacter>> Characters;
+
+	/** Characters by grid cell */
+	TMap<FIntPoint, TArray<AShooterCharacter*>> Grid;
+
+	/** Frame the grid was last built on */
+	uint64 GridFrame = MAX_uint64;
+
+	/** Rebuilds the grid if it's stale */
+	void UpdateGrid();
+
+	/** Returns the grid cell for a location */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** Returns true if any character accepted by the filter is within the radius of the location */
+	bool AnyCharacterWithinRadius(const FVector& Location, float Radius, TFunctionRef<bool(const AShooterCharacter*)> Filter);
+
+	/** Runs the encroachment checks for a start */
+	EShooterStartFit ComputeStartFit(APlayerStart* Start, const APawn* PawnToFit) const;
+};
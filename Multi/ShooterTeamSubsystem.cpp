@@ -0,0 +1,117 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterTeamSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+void UShooterTeamSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// one entry per team, including players without one yet. The last enum entry is the generated _MAX
+	Teams.SetNum(StaticEnum<EShooterTeam>()->NumEnums() - 1);
+}
+
+void UShooterTeamSubsystem::SetPlayerTeam(AShooterPlayerState* PlayerState, EShooterTeam Team)
+{
+	if (const FMemberSlot* Slot = PlayerSlots.Find(PlayerState))
+	{
+		if (Slot->Team == Team)
+		{
+			return;
+		}
+
+		RemoveMember(Teams[static_cast<uint8>(Slot->Team)].Players, PlayerSlots, PlayerState);
+	}
+
+	AddMember(Teams[static_cast<uint8>(Team)].Players, PlayerSlots, PlayerState, Team);
+}
+
+void UShooterTeamSubsystem::RemovePlayer(AShooterPlayerState* PlayerState)
+{
+	if (const FMemberSlot* Slot = PlayerSlots.Find(PlayerState))
+	{
+		RemoveMember(Teams[static_cast<uint8>(Slot->Team)].Players, PlayerSlots, PlayerState);
+	}
+}
+
+void UShooterTeamSubsystem::SetPawnTeam(APawn* Pawn, EShooterTeam Team)
+{
+	if (const FMemberSlot* Slot = PawnSlots.Find(Pawn))
+	{
+		if (Slot->Team == Team)
+		{
+			return;
+		}
+
+		RemoveMember(Teams[static_cast<uint8>(Slot->Team)].Pawns, PawnSlots, Pawn);
+	}
+
+	AddMember(Teams[static_cast<uint8>(Team)].Pawns, PawnSlots, Pawn, Team);
+}
+
+void UShooterTeamSubsystem::RemovePawn(APawn* Pawn)
+{
+	if (const FMemberSlot* Slot = PawnSlots.Find(Pawn))
+	{
+		RemoveMember(Teams[static_cast<uint8>(Slot->Team)].Pawns, PawnSlots, Pawn);
+	}
+}
+
+EShooterTeam UShooterTeamSubsystem::GetTeam(const AActor* Actor) const
+{
+	if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		if (const FMemberSlot* Slot = PawnSlots.Find(Pawn))
+		{
+			return Slot->Team;
+		}
+	}
+	else if (const AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>(Actor))
+	{
+		if (const FMemberSlot* Slot = PlayerSlots.Find(PlayerState))
+		{
+			return Slot->Team;
+		}
+	}
+
+	return EShooterTeam::None;
+}
+
+bool UShooterTeamSubsystem::AreTeammates(const AActor* A, const AActor* B) const
+{
+	const EShooterTeam TeamA = GetTeam(A);
+	return TeamA != EShooterTeam::None && TeamA == GetTeam(B);
+}
+
+bool UShooterTeamSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+template<typename MemberType>
+void UShooterTeamSubsystem::AddMember(TArray<TObjectPtr<MemberType>>& List, TMap<TObjectKey<MemberType>, FMemberSlot>& Slots, MemberType* Member, EShooterTeam Team)
+{
+	FMemberSlot& Slot = Slots.Add(Member);
+	Slot.Team = Team;
+	Slot.Index = List.Add(Member);
+}
+
+template<typename MemberType>
+void UShooterTeamSubsystem::RemoveMember(TArray<TObjectPtr<MemberType>>& List, TMap<TObjectKey<MemberType>, FMemberSlot>& Slots, MemberType* Member)
+{
+	FMemberSlot Slot;
+	if (!Slots.RemoveAndCopyValue(Member, Slot))
+	{
+		return;
+	}
+
+	List.RemoveAtSwap(Slot.Index);
+
+	// the last member moved into the hole
+	if (List.IsValidIndex(Slot.Index))
+	{
+		Slots.FindChecked(List[Slot.Index].Get()).Index = Slot.Index;
+	}
+}
@@ -0,0 +1,101 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ShooterPlayerState.h"
+#include "ShooterTeamSubsystem.generated.h"
+
+/**
+ *  Player states and live pawns on a team
+ */
+USTRUCT()
+struct FShooterTeamMembers
+{
+	GENERATED_BODY()
+
+	/** Players on the team */
+	UPROPERTY()
+	TArray<TObjectPtr<AShooterPlayerState>> Players;
+
+	/** Live pawns on the team */
+	UPROPERTY()
+	TArray<TObjectPtr<APawn>> Pawns;
+};
+
+/**
+ *  Server side registry of team membership
+ *  Keeps a contiguous array of players and live pawns per team, with constant time lookup, add and removal
+ *  The game mode updates players on join and logout, characters update their pawn on possess, death and removal
+ */
+UCLASS()
+class MULTI_API UShooterTeamSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Creates the team lists */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Adds the player to the team, moving them from their previous team if needed */
+	void SetPlayerTeam(AShooterPlayerState* PlayerState, EShooterTeam Team);
+
+	/** Removes the player from their team */
+	void RemovePlayer(AShooterPlayerState* PlayerState);
+
+	/** Adds a live pawn to the team, moving it from its previous team if needed */
+	void SetPawnTeam(APawn* Pawn, EShooterTeam Team);
+
+	/** Removes a pawn from its team */
+	void RemovePawn(APawn* Pawn);
+
+	/** Returns the players on the team */
+	const TArray<TObjectPtr<AShooterPlayerState>>& GetPlayers(EShooterTeam Team) const { return Teams[static_cast<uint8>(Team)].Players; }
+
+	/** Returns the live pawns on the team */
+	const TArray<TObjectPtr<APawn>>& GetPawns(EShooterTeam Team) const { return Teams[static_cast<uint8>(Team)].Pawns; }
+
+	/** Returns the number of players on the team */
+	int32 GetNumPlayers(EShooterTeam Team) const { return GetPlayers(Team).Num(); }
+
+	/** Returns the team of a registered player state or pawn, or None */
+	EShooterTeam GetTeam(const AActor* Actor) const;
+
+	/** Returns true if both actors are registered on the same team */
+	bool AreTeammates(const AActor* A, const AActor* B) const;
+
+protected:
+
+	/** Only run in game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Where a member is stored */
+	struct FMemberSlot
+	{
+		EShooterTeam Team = EShooterTeam::None;
+		int32 Index = INDEX_NONE;
+	};
+
+	/** Members by team, indexed by EShooterTeam */
+	UPROPERTY()
+	TArray<FShooterTeamMembers> Teams;
+
+	/** Slot of every registered player */
+	TMap<TObjectKey<AShooterPlayerState>, FMemberSlot> PlayerSlots;
+
+	/** Slot of every registered pawn */
+	TMap<TObjectKey<APawn>, FMemberSlot> PawnSlots;
+
+	/** Adds a member to a team list and records its slot */
+	template<typename MemberType>
+	static void AddMember(TArray<TObjectPtr<MemberType>>& List, TMap<TObjectKey<MemberType>, FMemberSlot>& Slots, MemberType* Member, EShooterTeam Team);
+
+	/** Removes a member from a team list, patching the slot of the member moved into its place */
+	template<typename MemberType>
+	static void RemoveMember(TArray<TObjectPtr<MemberType>>& List, TMap<TObjectKey<MemberType>, FMemberSlot>& Slots, MemberType* Member);
+};
@@ -8,6 +8,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/World.h"
 #include "ShooterGameMode.h"
+#include "ShooterSignificanceSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
@@ -23,6 +24,12 @@ void AShooterNPC::BeginPlay()
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
 	Weapon = GetWorld()->SpawnActor<AShooterWeapon>(WeaponClass, GetActorTransform(), SpawnParams);
+
+	// register with the significance manager
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->RegisterPawn(this);
+	}
 }
 
 void AShooterNPC::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -31,6 +38,12 @@ void AShooterNPC::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// unregister from the significance manager
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->UnregisterPawn(this);
+	}
 }
 
 float AShooterNPC::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
@@ -44,6 +57,12 @@ float AShooterNPC::TakeDamage(float Damage, struct FDamageEvent const& DamageEve
 	// Reduce HP
 	CurrentHP -= Damage;
 
+	// keep NPCs that are taking damage fully significant
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->ReportCombat(this);
+	}
+
 	// Have we depleted HP?
 	if (CurrentHP <= 0.0f)
 	{
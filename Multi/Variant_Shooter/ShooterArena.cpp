@@ -0,0 +1,207 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterArena.h"
+#include "ShooterArenaSubsystem.h"
+#include "ShooterGameMode.h"
+#include "ShooterGameState.h"
+#include "ShooterTeamSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Net/UnrealNetwork.h"
+
+AShooterArena::AShooterArena()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// create the bounds
+	Bounds = CreateDefaultSubobject<UBoxComponent>(TEXT("Bounds"));
+	RootComponent = Bounds;
+
+	Bounds->SetBoxExtent(FVector(5000.0f, 5000.0f, 2000.0f));
+	Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	// every client needs its arena's scores, and arenas are cheap
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetNetUpdateFrequency(2.0f);
+}
+
+bool AShooterArena::ContainsLocation(const FVector& Location) const
+{
+	return Bounds->Bounds.GetBox().IsInsideOrOn(Location);
+}
+
+void AShooterArena::AddPlayer(AShooterPlayerState* PlayerState)
+{
+	if (!PlayerState || Players.Contains(PlayerState))
+	{
+		return;
+	}
+
+	Players.Add(PlayerState);
+	PlayerState->ArenaIndex = ArenaIndex;
+	PlayerState->OnRep_ArenaIndex();
+
+	// Add to Red if Red has less players OR if it is a tie. The game mode registers the team afterwards
+	if (GetNumTeamPlayers(EShooterTeam::Red) <= GetNumTeamPlayers(EShooterTeam::Blue))
+	{
+		PlayerState->Team = EShooterTeam::Red;
+	}
+	else
+	{
+		PlayerState->Team = EShooterTeam::Blue;
+	}
+}
+
+void AShooterArena::RemovePlayer(AShooterPlayerState* PlayerState)
+{
+	if (Players.Remove(PlayerState) == 0)
+	{
+		return;
+	}
+
+	PlayerState->ArenaIndex = INDEX_NONE;
+	PlayerState->OnRep_ArenaIndex();
+}
+
+int32 AShooterArena::GetNumTeamPlayers(EShooterTeam Team) const
+{
+	const UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>();
+	if (!Teams)
+	{
+		return 0;
+	}
+
+	int32 NumPlayers = 0;
+	for (const AShooterPlayerState* PlayerState : Teams->GetPlayers(Team))
+	{
+		NumPlayers += PlayerState && PlayerState->ArenaIndex == ArenaIndex ? 1 : 0;
+	}
+
+	return NumPlayers;
+}
+
+void AShooterArena::AddTeamScore(EShooterTeam Team)
+{
+	// kills between the win and the reset don't count
+	if (bMatchEnded)
+	{
+		return;
+	}
+
+	if (Team == EShooterTeam::Red)
+	{
+		RedTeamScore++;
+	}
+	else if (Team == EShooterTeam::Blue)
+	{
+		BlueTeamScore++;
+	}
+
+	OnRep_TeamScores();
+
+	// only this arena's players see the result
+	FShooterAlert Alert;
+	Alert.ArenaIndex = ArenaIndex;
+
+	if (RedTeamScore >= ScoreToWin)
+	{
+		Alert.Type = EShooterAlert::RedTeamWins;
+		Alert.Color = EShooterAlertColor::Red;
+	}
+	else if (BlueTeamScore >= ScoreToWin)
+	{
+		Alert.Type = EShooterAlert::BlueTeamWins;
+		Alert.Color = EShooterAlertColor::Blue;
+	}
+	else
+	{
+		return;
+	}
+
+	if (AShooterGameState* GameState = GetWorld()->GetGameState<AShooterGameState>())
+	{
+		GameState->SendAlert(Alert);
+	}
+
+	// the other arenas keep playing, so only this one resets
+	bMatchEnded = true;
+	GetWorld()->GetTimerManager().SetTimer(ResetTimer, this, &AShooterArena::ResetArenaMatch, ResetDelay, false);
+}
+
+void AShooterArena::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		Arenas->RegisterArena(this);
+	}
+}
+
+void AShooterArena::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorld()->GetTimerManager().ClearTimer(ResetTimer);
+
+	if (UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		Arenas->UnregisterArena(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AShooterArena::ResetArenaMatch()
+{
+	bMatchEnded = false;
+	RedTeamScore = 0;
+	BlueTeamScore = 0;
+	OnRep_TeamScores();
+
+	AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	AShooterGameState* GameState = GetWorld()->GetGameState<AShooterGameState>();
+
+	for (AShooterPlayerState* PlayerState : Players)
+	{
+		PlayerState->SetScore(0.0f);
+		PlayerState->OnRep_Score();
+		PlayerState->ResetKillStreak();
+
+		if (GameState)
+		{
+			GameState->Scoreboard.ResetPlayer(PlayerState);
+		}
+
+		// respawn everyone for the new match
+		AController* Controller = PlayerState->GetOwningController();
+		if (APawn* Pawn = PlayerState->GetPawn())
+		{
+			if (Controller)
+			{
+				Controller->UnPossess();
+			}
+			Pawn->Destroy();
+		}
+
+		if (GameMode && Controller)
+		{
+			GameMode->QueueRespawn(Controller);
+		}
+	}
+}
+
+void AShooterArena::OnRep_TeamScores()
+{
+	OnTeamScoresChanged.Broadcast();
+}
+
+void AShooterArena::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AShooterArena, ArenaIndex);
+	DOREPLIFETIME(AShooterArena, RedTeamScore);
+	DOREPLIFETIME(AShooterArena, BlueTeamScore);
+}
@@ -0,0 +1,107 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ShooterPlayerState.h"
+#include "ShooterArena.generated.h"
+
+class UBoxComponent;
+
+/**
+ *  An isolated match instance inside a shared level
+ *  Players assigned to the arena spawn inside its bounds, only see actors in the same arena and play their own match to the score limit
+ *  Place several of these, spatially separated, to host multiple matches in one server process
+ */
+UCLASS()
+class MULTI_API AShooterArena : public AActor
+{
+	GENERATED_BODY()
+
+	/** Bounds of the arena. Player starts and pickups inside belong to it */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UBoxComponent* Bounds;
+
+protected:
+
+	/** Max number of players in this arena */
+	UPROPERTY(EditAnywhere, Category="Arena", meta = (ClampMin = 2, ClampMax = 64))
+	int32 MaxPlayers = 8;
+
+	/** Team score that ends the arena's match */
+	UPROPERTY(EditAnywhere, Category="Arena", meta = (ClampMin = 1))
+	int32 ScoreToWin = 10;
+
+	/** Time between the end of a match and the next one */
+	UPROPERTY(EditAnywhere, Category="Arena", meta = (ClampMin = 0, ClampMax = 30, Units = "s"))
+	float ResetDelay = 5.0f;
+
+	/** Players in the arena, server only */
+	UPROPERTY()
+	TArray<TObjectPtr<AShooterPlayerState>> Players;
+
+	/** True between the winning kill and the reset */
+	bool bMatchEnded = false;
+
+	/** Timer to reset the arena's match */
+	FTimerHandle ResetTimer;
+
+public:
+
+	/** Constructor */
+	AShooterArena();
+
+	/** Index of the arena, assigned by the server */
+	UPROPERTY(Replicated)
+	int32 ArenaIndex = INDEX_NONE;
+
+	/** Red team score for the arena's match */
+	UPROPERTY(ReplicatedUsing = OnRep_TeamScores)
+	int32 RedTeamScore = 0;
+
+	/** Blue team score for the arena's match */
+	UPROPERTY(ReplicatedUsing = OnRep_TeamScores)
+	int32 BlueTeamScore = 0;
+
+	/** Called when the team scores change */
+	FSimpleMulticastDelegate OnTeamScoresChanged;
+
+	/** Returns true if the location is inside the arena */
+	bool ContainsLocation(const FVector& Location) const;
+
+	/** Returns true if the arena has room for another player */
+	bool HasRoom() const { return Players.Num() < MaxPlayers; }
+
+	/** Returns the number of players in the arena */
+	int32 GetNumPlayers() const { return Players.Num(); }
+
+	/** Adds a player to the arena and puts them on the smaller team */
+	void AddPlayer(AShooterPlayerState* PlayerState);
+
+	/** Removes a player from the arena */
+	void RemovePlayer(AShooterPlayerState* PlayerState);
+
+	/** Adds a point to the team and ends the arena's match at the score limit */
+	void AddTeamScore(EShooterTeam Team);
+
+protected:
+
+	/** Registers with the arena subsystem */
+	virtual void BeginPlay() override;
+
+	/** Unregisters from the arena subsystem */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Returns the number of the arena's players on the team, from the team registry */
+	int32 GetNumTeamPlayers(EShooterTeam Team) const;
+
+	/** Clears the scores and respawns the arena's players */
+	void ResetArenaMatch();
+
+	/** Updates the HUD */
+	UFUNCTION()
+	void OnRep_TeamScores();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+};
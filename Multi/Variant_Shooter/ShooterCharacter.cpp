@@ -3,9 +3,12 @@
 
 #include "ShooterCharacter.h"
 #include "ShooterWeapon.h"
+#include "ShooterProjectile.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/DamageEvents.h"
 #include "EnhancedInputComponent.h"
 #include "ShooterBPLibrary.h"
-#include "ShooterBulletCounterUI.h"
+#include "MultiCameraManager.h"
 #include "Components/InputComponent.h"
 #include "Components/PawnNoiseEmitterComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -15,6 +18,13 @@
 #include "TimerManager.h"
 #include "ShooterGameMode.h"
 #include "ShooterGameState.h"
+#include "ShooterPlayerController.h"
+#include "ShooterArenaSubsystem.h"
+#include "ShooterArena.h"
+#include "ShooterSignificanceSubsystem.h"
+#include "ShooterSpawnRegistrySubsystem.h"
+#include "ShooterTeamSubsystem.h"
+#include "ShooterGameplayCueSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/GameMode.h"
@@ -22,6 +32,12 @@
 void AShooterCharacter::OnRep_CurrentHP()
 {
 	OnDamaged.Broadcast(FMath::Max(0.0f, CurrentHP / MaxHP));
+
+	// keep characters that are taking damage fully significant
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->ReportCombat(this);
+	}
 }
 
 AShooterCharacter::AShooterCharacter()
@@ -42,6 +58,21 @@ void AShooterCharacter::BeginPlay()
 
 	// update the HUD
 	OnDamaged.Broadcast(1.0f);
+
+	// register with the significance manager
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->RegisterPawn(this);
+	}
+
+	// let the spawn registry track us for spawn safety checks
+	if (HasAuthority())
+	{
+		if (UShooterSpawnRegistrySubsystem* SpawnRegistry = GetWorld()->GetSubsystem<UShooterSpawnRegistrySubsystem>())
+		{
+			SpawnRegistry->RegisterCharacter(this);
+		}
+	}
 }
 
 void AShooterCharacter::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -49,7 +80,28 @@ void AShooterCharacter::EndPlay(EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 
 	// clear the respawn timer
-	GetWorld()->GetTimerManager().ClearTimer(RespawnTimer);
+	if (UShooterFixedStepSubsystem* FixedStep = GetWorld()->GetSubsystem<UShooterFixedStepSubsystem>())
+	{
+		FixedStep->ClearTimer(RespawnTimer);
+	}
+
+	// unregister from the significance manager
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->UnregisterPawn(this);
+	}
+
+	// unregister from the spawn registry
+	if (UShooterSpawnRegistrySubsystem* SpawnRegistry = GetWorld()->GetSubsystem<UShooterSpawnRegistrySubsystem>())
+	{
+		SpawnRegistry->UnregisterCharacter(this);
+	}
+
+	// leave the team
+	if (UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>())
+	{
+		Teams->RemovePawn(this);
+	}
 }
 
 void AShooterCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -79,8 +131,30 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 	}
 
 	// Reduce HP
+	const float PreviousHP = CurrentHP;
 	SetCurrentHP(CurrentHP - Damage);
 
+	// confirm the hit to the shooter
+	if (AShooterPlayerController* ShooterPC = Cast<AShooterPlayerController>(EventInstigator))
+	{
+		if (ShooterPC != GetController())
+		{
+			ShooterPC->AddHitFeedback(PreviousHP - FMath::Max(CurrentHP, 0.0f), IsHeadshot(DamageEvent), CurrentHP <= 0.0f, GetHitLocation(DamageEvent));
+		}
+	}
+
+	// remember who helped, for assists
+	if (EventInstigator && EventInstigator != GetController())
+	{
+		DamageContributors.AddUnique(EventInstigator);
+	}
+
+	// keep characters that are taking damage fully significant
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
+	{
+		Significance->ReportCombat(this);
+	}
+
 	// Have we depleted HP?
 	if (CurrentHP <= 0.0f)
 	{
@@ -94,6 +168,8 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 				if (APlayerState* KillPlayerState = EventInstigator->GetPlayerState<APlayerState>())
 				{
 					KillPlayerState->SetScore(KillPlayerState->GetScore() + 1);
+					KillPlayerState->OnRep_Score();
+					GameState->Scoreboard.AddKill(KillPlayerState);
 
 					// Add to kill streak
 					if (AShooterPlayerState* ShooterPlayerState = Cast<AShooterPlayerState>(KillPlayerState))
@@ -102,19 +178,44 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 					}
 				}
 
+				GameState->Scoreboard.AddDeath(GetPlayerState());
+
+				// add to the kill feed
+				const APlayerState* KillerPlayerState = EventInstigator->GetPlayerState<APlayerState>();
+				const AShooterProjectile* Projectile = Cast<AShooterProjectile>(DamageCauser);
+
+				GameState->KillFeed.AddKill(
+					KillerPlayerState ? KillerPlayerState->GetPlayerId() : INDEX_NONE,
+					GetPlayerState() ? GetPlayerState()->GetPlayerId() : INDEX_NONE,
+					Projectile ? Projectile->GetKillFeedWeaponId() : 0,
+					IsHeadshot(DamageEvent),
+					GameState->GetServerWorldTimeSeconds());
+
+				// everyone else who damaged us gets an assist
+				for (const TWeakObjectPtr<AController>& Contributor : DamageContributors)
+				{
+					if (Contributor.IsValid() && Contributor.Get() != EventInstigator)
+					{
+						GameState->Scoreboard.AddAssist(Contributor->GetPlayerState<APlayerState>());
+					}
+				}
+
 				// Increase team score by 1
 				if (GameState)
 				{
 					// Get the team
 					if (AShooterCharacter* KillerCharacter = Cast<AShooterCharacter>(EventInstigator->GetPawn()))
 					{
-						if (KillerCharacter->Team == EShooterTeam::Red) // Red team
+						UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>();
+
+						if (AShooterArena* Arena = Arenas ? Arenas->GetArena(Arenas->GetArenaIndexFor(EventInstigator)) : nullptr)
 						{
-							GameState->RedTeamScore++;
+							// Arenas keep their own score
+							Arena->AddTeamScore(KillerCharacter->Team);
 						}
-						else if (KillerCharacter->Team == EShooterTeam::Blue) // Blue team
+						else
 						{
-							GameState->BlueTeamScore++;
+							GameState->AddTeamScore(KillerCharacter->Team);
 						}
 					}
 				}
@@ -126,19 +227,20 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 			if (DeadPlayerState->GetKillStreak() >= 3)
 			{
 				if (AShooterPlayerState* KillerPlayerState = Cast<AShooterPlayerState>(EventInstigator->GetPlayerState<APlayerState>()))				{
-					FString AlertMessage = FString::Printf(TEXT("%s ended %s's streak!"), 
-						*KillerPlayerState->GetPlayerName(), *DeadPlayerState->GetPlayerName());
+					FShooterAlert Alert;
+					Alert.Type = EShooterAlert::StreakEnded;
+					Alert.Player = KillerPlayerState->GetPlayerId();
+					Alert.OtherPlayer = DeadPlayerState->GetPlayerId();
             
 					// Get killer's team color
-					FLinearColor TeamColor = FLinearColor::White;
 					if (AShooterCharacter* KillerCharacter = Cast<AShooterCharacter>(EventInstigator->GetPawn()))
 					{
-						TeamColor = (KillerCharacter->Team == EShooterTeam::Red) ? FLinearColor::Red : FLinearColor::Blue;
+						Alert.Color = (KillerCharacter->Team == EShooterTeam::Red) ? EShooterAlertColor::Red : EShooterAlertColor::Blue;
 					}
             
 					if (AShooterGameState* GameState = UShooterBPLibrary::GetShooterGameState(this))
 					{
-						GameState->MulticastOnAlert(AlertMessage, TeamColor, 2.5f);
+						GameState->SendAlert(KillerPlayerState, Alert);
 					}
 				}
 			}
@@ -156,11 +258,22 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 
 void AShooterCharacter::DoStartFiring()
 {
+	// predict the recoil locally before the server fires
+	if (AMultiCameraManager* CameraManager = GetMultiCameraManager())
+	{
+		CameraManager->StartPredictedRecoil(CurrentWeapon);
+	}
+
 	ServerDoStartFiring();
 }
 
 void AShooterCharacter::DoStopFiring()
-{		
+{
+	if (AMultiCameraManager* CameraManager = GetMultiCameraManager())
+	{
+		CameraManager->StopPredictedRecoil();
+	}
+
 	ServerDoStopFiring();
 }
 
@@ -189,6 +302,13 @@ void AShooterCharacter::PlayFiringMontage(UAnimMontage* Montage)
 
 void AShooterCharacter::AddWeaponRecoil(float Recoil)
 {
+	// the camera manager already predicted this shot's recoil, so reconcile with it
+	if (AMultiCameraManager* CameraManager = GetMultiCameraManager())
+	{
+		CameraManager->ConfirmRecoilShot(CurrentWeapon);
+		return;
+	}
+
 	// apply the recoil as pitch input
 	AddControllerPitchInput(Recoil);
 }
@@ -285,6 +405,30 @@ AShooterWeapon* AShooterCharacter::FindWeaponOfType(TSubclassOf<AShooterWeapon>
 
 }
 
+bool AShooterCharacter::IsHeadshot(const FDamageEvent& DamageEvent) const
+{
+	if (!DamageEvent.IsOfType(FPointDamageEvent::ClassID))
+	{
+		return false;
+	}
+
+	const FPointDamageEvent& PointDamage = static_cast<const FPointDamageEvent&>(DamageEvent);
+	const float HeadZ = GetActorLocation().Z + GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+	return PointDamage.HitInfo.ImpactPoint.Z >= HeadZ - HeadshotHeight;
+}
+
+FVector AShooterCharacter::GetHitLocation(const FDamageEvent& DamageEvent) const
+{
+	// radial and plain damage have no single impact point
+	if (!DamageEvent.IsOfType(FPointDamageEvent::ClassID))
+	{
+		return GetActorLocation();
+	}
+
+	return static_cast<const FPointDamageEvent&>(DamageEvent).HitInfo.ImpactPoint;
+}
+
 void AShooterCharacter::Die()
 {
 	// deactivate the weapon
@@ -301,7 +445,7 @@ void AShooterCharacter::Die()
 	// increment the team score
 	if (AShooterGameMode* GM = Cast<AShooterGameMode>(GetWorld()->GetAuthGameMode()))
 	{
-		GM->IncrementTeamScore(TeamByte);
+		GM->IncrementTeamScore(static_cast<uint8>(Team));
 	}
 		
 	// stop character movement
@@ -310,10 +454,32 @@ void AShooterCharacter::Die()
 	// disable controls
 	DisableInput(nullptr);
 
-	MulticastOnDeath();
+	// call the BP handler here so server side death logic runs on dedicated servers too
+	BP_OnDeath();
+
+	// critical so the owner always gets the death screen
+	if (UShooterGameplayCueSubsystem* Cues = GetWorld()->GetSubsystem<UShooterGameplayCueSubsystem>())
+	{
+		Cues->SendCue(EShooterCue::Death, this, 0, true);
+	}
 
-	// schedule character respawn
-	GetWorld()->GetTimerManager().SetTimer(RespawnTimer, this, &AShooterCharacter::OnRespawn, RespawnTime, false);
+	// dead characters are no longer live team members
+	if (UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>())
+	{
+		Teams->RemovePawn(this);
+	}
+
+	// schedule character respawn on the fixed step so it doesn't depend on server frame rate
+	if (UShooterFixedStepSubsystem* FixedStep = GetWorld()->GetSubsystem<UShooterFixedStepSubsystem>())
+	{
+		FixedStep->SetTimer(RespawnTimer, FSimpleDelegate::CreateUObject(this, &AShooterCharacter::OnRespawn), RespawnTime);
+	}
+	else
+	{
+		// still respawn without the fixed step, just on the frame timer
+		FTimerHandle FallbackRespawnTimer;
+		GetWorldTimerManager().SetTimer(FallbackRespawnTimer, this, &AShooterCharacter::OnRespawn, RespawnTime, false);
+	}
 }
 
 void AShooterCharacter::OnRespawn()
@@ -323,10 +489,15 @@ void AShooterCharacter::OnRespawn()
 		AController* OldController = Controller;
 		// Tell the current controller it doesn't control this pawn anymore
 		Controller->UnPossess();
-		if (AGameModeBase* GameMode = UGameplayStatics::GetGameMode(this))
+		if (AShooterGameMode* GameMode = Cast<AShooterGameMode>(GetWorld()->GetAuthGameMode()))
+		{
+			// Queue the old controller to restart, so a wave of deaths doesn't respawn everyone on the same frame
+			GameMode->QueueRespawn(OldController);
+		}
+		else if (AGameModeBase* GameModeBase = UGameplayStatics::GetGameMode(this))
 		{
 			// Force the old controller to restart
-			GameMode->RestartPlayer(OldController);
+			GameModeBase->RestartPlayer(OldController);
 		}
 	}
 	// destroy the character to force the PC to respawn
@@ -344,6 +515,23 @@ void AShooterCharacter::GetLifetimeReplicatedProps(TArray<class FLifetimePropert
 	DOREPLIFETIME(AShooterCharacter, Team);
 
 	DOREPLIFETIME(AShooterCharacter, ReplicatedControlRotation);
+
+	// Only the owner needs the current weapon, for recoil prediction
+	DOREPLIFETIME_CONDITION(AShooterCharacter, CurrentWeapon, COND_OwnerOnly);
+}
+
+bool AShooterCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	// players in other arenas never see this character
+	if (const UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		if (!Arenas->IsRelevantInArena(this, RealViewer, ViewTarget))
+		{
+			return false;
+		}
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
 }
 
 void AShooterCharacter::Tick(float DeltaSeconds)
@@ -361,14 +549,48 @@ void AShooterCharacter::OnRep_Team()
 	BP_OnTeamSet();
 }
 
+FShooterVitals AShooterCharacter::GetVitals() const
+{
+	FShooterVitals Vitals;
+	Vitals.LifePercent = MaxHP > 0.0f ? FMath::Clamp(CurrentHP / MaxHP, 0.0f, 1.0f) : 0.0f;
+
+	// dead characters show an empty counter
+	if (CurrentWeapon && CurrentHP > 0.0f)
+	{
+		Vitals.Bullets = CurrentWeapon->GetBulletCount();
+		Vitals.MagazineSize = CurrentWeapon->GetMagazineSize();
+	}
+
+	return Vitals;
+}
+
 AShooterWeapon* AShooterCharacter::GetCurrentWeapon()
 {
 	return CurrentWeapon;
 }
 
+AMultiCameraManager* AShooterCharacter::GetMultiCameraManager() const
+{
+	if (const APlayerController* PC = Cast<APlayerController>(GetController()))
+	{
+		return Cast<AMultiCameraManager>(PC->PlayerCameraManager);
+	}
+
+	return nullptr;
+}
+
 void AShooterCharacter::SetTeam(EShooterTeam InTeam)
 {
 	Team = InTeam;
+
+	// register as a live member of the team
+	if (HasAuthority())
+	{
+		if (UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>())
+		{
+			Teams->SetPawnTeam(this, Team);
+		}
+	}
     
 	if (GetNetMode() == NM_ListenServer)
 	{
@@ -386,7 +608,7 @@ void AShooterCharacter::SetCurrentHP(float InCurrentHP)
 	}
 }
 
-void AShooterCharacter::MulticastOnDeath_Implementation()
+void AShooterCharacter::PlayDeathCue()
 {
 	// reset the bullet counter UI
 	OnBulletCountUpdated.Broadcast(0, 0);
@@ -397,8 +619,11 @@ void AShooterCharacter::MulticastOnDeath_Implementation()
 		OnDeath.Broadcast(RespawnTime); // shows death screen
 	}
 	
-	// call the BP handler
-	BP_OnDeath();
+	// the server already called the BP handler when the character died
+	if (!HasAuthority())
+	{
+		BP_OnDeath();
+	}
 }
 
 void AShooterCharacter::ServerDoStartFiring_Implementation()
@@ -5,13 +5,16 @@
 #include "CoreMinimal.h"
 #include "MultiCharacter.h"
 #include "ShooterWeaponHolder.h"
+#include "ShooterVitalsSource.h"
 #include "ShooterPlayerState.h"
+#include "ShooterFixedStepSubsystem.h"
 #include "ShooterCharacter.generated.h"
 
 class AShooterWeapon;
 class UInputAction;
 class UInputComponent;
 class UPawnNoiseEmitterComponent;
+class AMultiCameraManager;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FBulletCountUpdatedDelegate, int32, MagazineSize, int32, Bullets);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDamagedDelegate, float, LifePercent);
@@ -22,7 +25,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDamagedDelegate, float, LifePercent
  *  Manages health and death
  */
 UCLASS(abstract)
-class MULTI_API AShooterCharacter : public AMultiCharacter, public IShooterWeaponHolder
+class MULTI_API AShooterCharacter : public AMultiCharacter, public IShooterWeaponHolder, public IShooterVitalsSource
 {
 	GENERATED_BODY()
 	
@@ -56,6 +59,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Health")
 	float MaxHP = 500.0f;
 
+	/** Point damage this close to the top of the capsule counts as a headshot */
+	UPROPERTY(EditAnywhere, Category="Health", meta = (ClampMin = 0, Units = "cm"))
+	float HeadshotHeight = 25.0f;
+
 	/** Current HP remaining to this character */
 	UPROPERTY(ReplicatedUsing=OnRep_CurrentHP)
 	float CurrentHP = 0.0f;
@@ -63,20 +70,21 @@ protected:
 	UFUNCTION()
 	void OnRep_CurrentHP();
 
-	/** Team ID for this character*/
-	UPROPERTY(EditAnywhere, Category="Team")
-	uint8 TeamByte = 0;
+	/** Controllers that damaged this character during this life, for assists. Server only */
+	TArray<TWeakObjectPtr<AController>> DamageContributors;
 
 	/** List of weapons picked up by the character */
 	TArray<AShooterWeapon*> OwnedWeapons;
 
-	/** Weapon currently equipped and ready to shoot with */
+	/** Weapon currently equipped and ready to shoot with. Replicated so the owner can predict recoil */
+	UPROPERTY(Replicated)
 	TObjectPtr<AShooterWeapon> CurrentWeapon;
 
 	UPROPERTY(EditAnywhere, Category ="Destruction", meta = (ClampMin = 0, ClampMax = 10, Units = "s"))
 	float RespawnTime = 5.0f;
 
-	FTimerHandle RespawnTimer;
+	/** Fixed step timer to respawn after death */
+	FShooterStepTimerHandle RespawnTimer;
 
 public:
 
@@ -157,6 +165,13 @@ public:
 
 	//~End IShooterWeaponHolder interface
 
+	//~Begin IShooterVitalsSource interface
+
+	/** Returns the current weapon's ammo and the remaining life */
+	virtual FShooterVitals GetVitals() const override;
+
+	//~End IShooterVitalsSource interface
+
 protected:
 
 	/** Returns true if the character already owns a weapon of the given class */
@@ -165,6 +180,12 @@ protected:
 	/** Called when this character's HP is depleted */
 	void Die();
 
+	/** Returns true if the damage event hit the head */
+	bool IsHeadshot(const FDamageEvent& DamageEvent) const;
+
+	/** Returns where the damage hit this character. The impact point for point damage, the character's location otherwise */
+	FVector GetHitLocation(const FDamageEvent& DamageEvent) const;
+
 	/** Called to allow Blueprint code to react to this character's death */
 	UFUNCTION(BlueprintImplementableEvent, Category="Shooter", meta = (DisplayName = "On Death"))
 	void BP_OnDeath();
@@ -174,6 +195,9 @@ protected:
 
 	virtual void GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/** Hides the character from players in other arenas */
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 	virtual void Tick(float DeltaSeconds) override;
 
 public:
@@ -186,8 +210,8 @@ public:
 	UFUNCTION(Server, Reliable)
 	void ServerDoSwitchWeapon();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastOnDeath();
+	/** Resets the HUD, shows the death screen and calls the BP handler on clients when the death cue arrives */
+	void PlayDeathCue();
 
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_Team)
 	EShooterTeam Team;
@@ -202,6 +226,9 @@ public:
 	/** Returns current weapon pointer */
 	AShooterWeapon* GetCurrentWeapon();
 
+	/** Returns the camera manager of the controlling player, if it supports recoil prediction */
+	AMultiCameraManager* GetMultiCameraManager() const;
+
 	UPROPERTY(Replicated, BlueprintReadOnly)
 	FRotator ReplicatedControlRotation;
 
@@ -0,0 +1,147 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterClockSyncComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UShooterClockSyncComponent::UShooterClockSyncComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	SetIsReplicatedByDefault(true);
+}
+
+double UShooterClockSyncComponent::GetServerTime() const
+{
+	// the server is the clock
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return GetLocalTime();
+	}
+
+	return GetLocalTime() + Offset;
+}
+
+bool UShooterClockSyncComponent::HasSyncedTime() const
+{
+	return bHasOffset || GetOwnerRole() == ROLE_Authority;
+}
+
+void UShooterClockSyncComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// only remote owning clients need to sync
+	APlayerController* PC = Cast<APlayerController>(GetOwner());
+	if (PC && PC->IsLocalController() && GetOwnerRole() != ROLE_Authority)
+	{
+		SendPing();
+	}
+}
+
+void UShooterClockSyncComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	GetWorld()->GetTimerManager().ClearTimer(SyncTimer);
+}
+
+void UShooterClockSyncComponent::SendPing()
+{
+	ServerRequestTime(GetLocalTime());
+
+	// burst until the window is full, then slow down
+	const float NextPing = Samples.Num() < SampleWindow ? BurstInterval : SyncInterval;
+	GetWorld()->GetTimerManager().SetTimer(SyncTimer, this, &UShooterClockSyncComponent::SendPing, NextPing, false);
+}
+
+void UShooterClockSyncComponent::ServerRequestTime_Implementation(double ClientSendTime)
+{
+	ClientReceiveTime(ClientSendTime, GetLocalTime());
+}
+
+void UShooterClockSyncComponent::ClientReceiveTime_Implementation(double ClientSendTime, double ServerTime)
+{
+	const double Now = GetLocalTime();
+	const float SampleRoundTrip = Now - ClientSendTime;
+
+	// ignore replies that arrive out of order or from before a clock reset
+	if (SampleRoundTrip < 0.0f)
+	{
+		return;
+	}
+
+	// assume symmetric latency: the server stamped its time halfway through the round trip
+	FClockSample Sample;
+	Sample.RoundTripTime = SampleRoundTrip;
+	Sample.Offset = (ServerTime + SampleRoundTrip * 0.5) - Now;
+
+	Samples.Add(Sample);
+
+	if (Samples.Num() > SampleWindow)
+	{
+		Samples.RemoveAt(0);
+	}
+
+	UpdateEstimate();
+}
+
+void UShooterClockSyncComponent::UpdateEstimate()
+{
+	// find the fastest exchange in the window. It has the tightest error bound
+	float MinRoundTrip = UE_BIG_NUMBER;
+	for (const FClockSample& Sample : Samples)
+	{
+		MinRoundTrip = FMath::Min(MinRoundTrip, Sample.RoundTripTime);
+	}
+
+	// average the samples close to the fastest one, dropping congested outliers
+	const float MaxRoundTrip = MinRoundTrip * OutlierRoundTripScale + UE_KINDA_SMALL_NUMBER;
+
+	double OffsetSum = 0.0;
+	float RoundTripSum = 0.0f;
+	int32 Count = 0;
+
+	for (const FClockSample& Sample : Samples)
+	{
+		if (Sample.RoundTripTime <= MaxRoundTrip)
+		{
+			OffsetSum += Sample.Offset;
+			RoundTripSum += Sample.RoundTripTime;
+			++Count;
+		}
+	}
+
+	const double TargetOffset = OffsetSum / Count;
+
+	// the spread of the accepted offsets widens the error bound
+	double Spread = 0.0;
+	for (const FClockSample& Sample : Samples)
+	{
+		if (Sample.RoundTripTime <= MaxRoundTrip)
+		{
+			Spread = FMath::Max(Spread, FMath::Abs(Sample.Offset - TargetOffset));
+		}
+	}
+
+	RoundTripTime = RoundTripSum / Count;
+	Uncertainty = MinRoundTrip * 0.5f + Spread;
+
+	// snap on the first estimate, then converge smoothly so the clock never jumps
+	if (!bHasOffset)
+	{
+		Offset = TargetOffset;
+		bHasOffset = true;
+	}
+	else
+	{
+		Offset = FMath::Lerp(Offset, TargetOffset, static_cast<double>(OffsetSmoothing));
+	}
+}
+
+double UShooterClockSyncComponent::GetLocalTime() const
+{
+	return GetWorld()->GetTimeSeconds();
+}
@@ -0,0 +1,111 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ShooterClockSyncComponent.generated.h"
+
+/**
+ *  Keeps a smoothed estimate of the server clock on the owning client
+ *  Samples round trip time with unreliable NTP-style ping exchanges and filters out slow samples
+ *  Lag compensation, predicted firing and HUD countdowns should all read time from here
+ */
+UCLASS(ClassGroup=(Shooter), meta=(BlueprintSpawnableComponent))
+class MULTI_API UShooterClockSyncComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UShooterClockSyncComponent();
+
+	/** Returns the estimated current server time. On the server this is the world time */
+	UFUNCTION(BlueprintPure, Category="Clock")
+	double GetServerTime() const;
+
+	/** Returns the estimated error bound of the server time, in seconds */
+	UFUNCTION(BlueprintPure, Category="Clock")
+	float GetServerTimeUncertainty() const { return Uncertainty; }
+
+	/** Returns the filtered round trip time, in seconds */
+	UFUNCTION(BlueprintPure, Category="Clock")
+	float GetRoundTripTime() const { return RoundTripTime; }
+
+	/** Returns true once at least one sample has been received, or if running on the server */
+	UFUNCTION(BlueprintPure, Category="Clock")
+	bool HasSyncedTime() const;
+
+protected:
+
+	/** Time between pings once the initial burst is done */
+	UPROPERTY(EditAnywhere, Category="Clock", meta = (ClampMin = 0.1, ClampMax = 30, Units = "s"))
+	float SyncInterval = 2.0f;
+
+	/** Time between pings during the initial burst */
+	UPROPERTY(EditAnywhere, Category="Clock", meta = (ClampMin = 0.05, ClampMax = 5, Units = "s"))
+	float BurstInterval = 0.2f;
+
+	/** Number of samples kept for filtering. The initial burst fills this window */
+	UPROPERTY(EditAnywhere, Category="Clock", meta = (ClampMin = 3, ClampMax = 64))
+	int32 SampleWindow = 10;
+
+	/** Samples with a round trip above this multiple of the fastest one are ignored */
+	UPROPERTY(EditAnywhere, Category="Clock", meta = (ClampMin = 1, ClampMax = 10))
+	float OutlierRoundTripScale = 1.5f;
+
+	/** How quickly the offset converges on new estimates after the first one */
+	UPROPERTY(EditAnywhere, Category="Clock", meta = (ClampMin = 0, ClampMax = 1))
+	float OffsetSmoothing = 0.25f;
+
+	/** Starts pinging on the owning client */
+	virtual void BeginPlay() override;
+
+	/** Stops pinging */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Sends the client clock to the server */
+	UFUNCTION(Server, Unreliable)
+	void ServerRequestTime(double ClientSendTime);
+
+	/** Returns the echoed client clock and the server clock to the client */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceiveTime(double ClientSendTime, double ServerTime);
+
+private:
+
+	/** A single ping exchange result */
+	struct FClockSample
+	{
+		float RoundTripTime = 0.0f;
+		double Offset = 0.0;
+	};
+
+	/** Recent samples, oldest first */
+	TArray<FClockSample> Samples;
+
+	/** Smoothed offset from local time to server time */
+	double Offset = 0.0;
+
+	/** Filtered round trip time */
+	float RoundTripTime = 0.0f;
+
+	/** Estimated error bound */
+	float Uncertainty = UE_BIG_NUMBER;
+
+	/** True once the first sample has been received */
+	bool bHasOffset = false;
+
+	/** Ping timer */
+	FTimerHandle SyncTimer;
+
+	/** Sends a ping and schedules the next one */
+	void SendPing();
+
+	/** Recomputes the offset estimate from the sample window */
+	void UpdateEstimate();
+
+	/** Returns the local clock used for sampling */
+	double GetLocalTime() const;
+};
@@ -3,12 +3,18 @@
 
 #include "Variant_Shooter/ShooterGameMode.h"
 
-#include "EngineUtils.h"
 #include "ShooterCharacter.h"
 #include "ShooterGameState.h"
 #include "ShooterPlayerController.h"
-#include "ShooterUI.h"
-#include "Engine/PlayerStartPIE.h"
+#include "ShooterSpawnRegistrySubsystem.h"
+#include "ShooterArenaSubsystem.h"
+#include "ShooterArena.h"
+#include "ShooterTeamSubsystem.h"
+#include "ShooterChatSubsystem.h"
+#include "GameFramework/PlayerStart.h"
+#include "Engine/NetConnection.h"
+#include "Misc/PackageName.h"
+#include "Multi.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
@@ -19,18 +25,32 @@ bool AShooterGameMode::ShouldSpawnAtStartSpot(AController* Player)
 
 AActor* AShooterGameMode::ChoosePlayerStart_Implementation(AController* Player)
 {
+	UShooterSpawnRegistrySubsystem* SpawnRegistry = GetWorld()->GetSubsystem<UShooterSpawnRegistrySubsystem>();
+	if (!SpawnRegistry)
+	{
+		return Super::ChoosePlayerStart_Implementation(Player);
+	}
+
+	// Always prefer the "Play from Here" PlayerStart, if we have one while in PIE mode
+	if (APlayerStart* PlayInEditorStart = SpawnRegistry->GetPlayInEditorStart())
+	{
+		return PlayInEditorStart;
+	}
+
 	// Choose a player start
 	APlayerStart* FoundPlayerStart = nullptr;
 	UClass* PawnClass = GetDefaultPawnClassForController(Player);
 	APawn* PawnToFit = PawnClass ? PawnClass->GetDefaultObject<APawn>() : nullptr;
 	TArray<APlayerStart*> UnOccupiedStartPoints;
 	TArray<APlayerStart*> OccupiedStartPoints;
-	TArray<APlayerStart*> BackupStartPoints;
-	UWorld* World = GetWorld();
 
 	// Figure out the player's team
 	EShooterTeam Team = Player->GetPlayerState<AShooterPlayerState>()->Team;
 
+	// Keep players inside their arena, if the level hosts several
+	UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>();
+	const AShooterArena* Arena = Arenas ? Arenas->GetArena(Arenas->GetArenaIndexFor(Player)) : nullptr;
+
 	// Assign start tag based on team
 	FName PlayerStartTag = NAME_None;
 	switch (Team)
@@ -45,99 +65,73 @@ AActor* AShooterGameMode::ChoosePlayerStart_Implementation(AController* Player)
 		PlayerStartTag = "Blue";
 		break;
 	}
-	
-	for (TActorIterator<APlayerStart> It(World); It; ++It)
-	{
-		APlayerStart* PlayerStart = *It;
 
-		if (PlayerStart->IsA<APlayerStartPIE>())
-		{
-			// Always prefer the first "Play from Here" PlayerStart, if we find one while in PIE mode
-			FoundPlayerStart = PlayerStart;
-			break;
-		}
-		else if (PlayerStart->PlayerStartTag == "Backup")
-		{
-			BackupStartPoints.Add(PlayerStart);
-		}
-		// Prioritize player starts which match the team
-		else if (PlayerStartTag == NAME_None || PlayerStartTag == PlayerStart->PlayerStartTag)
+	// Backup starts are only used as a last resort
+	if (PlayerStartTag != "Backup")
+	{
+		for (APlayerStart* PlayerStart : SpawnRegistry->GetStartsWithTag(PlayerStartTag))
 		{
-			FVector ActorLocation = PlayerStart->GetActorLocation();
-			const FRotator ActorRotation = PlayerStart->GetActorRotation();
-			if (!World->EncroachingBlockingGeometry(PawnToFit, ActorLocation, ActorRotation))
+			if (!PlayerStart || (Arena && !Arena->ContainsLocation(PlayerStart->GetActorLocation())))
 			{
-				UnOccupiedStartPoints.Add(PlayerStart);
+				continue;
+			}
+
+			// Skip starts that have opposing team players within 1000 units
+			if (SpawnRegistry->IsEnemyWithinRadius(PlayerStart->GetActorLocation(), Team, 1000.0f))
+			{
+				continue;
 			}
-			else if (World->FindTeleportSpot(PawnToFit, ActorLocation, ActorRotation))
+
+			switch (SpawnRegistry->GetStartFit(PlayerStart, PawnToFit))
 			{
+			case EShooterStartFit::Free:
+				UnOccupiedStartPoints.Add(PlayerStart);
+				break;
+			case EShooterStartFit::Teleport:
 				OccupiedStartPoints.Add(PlayerStart);
+				break;
+			case EShooterStartFit::Blocked:
+				break;
 			}
 		}
 	}
-	if (FoundPlayerStart == nullptr)
-	{
-		// Remove starts that have opposing team players within 1000 units
-        for (int32 i = UnOccupiedStartPoints.Num() - 1; i >= 0; i--)
-        {
-            APlayerStart* StartPoint = UnOccupiedStartPoints[i];
-            FVector StartLocation = StartPoint->GetActorLocation();
-            
-            // Check for opposing team players within 1000 units
-            for (TActorIterator<AShooterCharacter> CharIt(World); CharIt; ++CharIt)
-            {
-                AShooterCharacter* Character = *CharIt;
-                if (Character && Character->Team != Team && Character->Team != EShooterTeam::None)
-                {
-                    float Distance = FVector::Dist(StartLocation, Character->GetActorLocation());
-                    if (Distance <= 1000.0f)
-                    {
-                        UnOccupiedStartPoints.RemoveAt(i);
-                        break; // No need to check more characters for this start point
-                    }
-                }
-            }
-        }
-        
-        for (int32 i = OccupiedStartPoints.Num() - 1; i >= 0; i--)
-        {
-            APlayerStart* StartPoint = OccupiedStartPoints[i];
-            FVector StartLocation = StartPoint->GetActorLocation();
-            
-            // Check for opposing team players within 1000 units
-            for (TActorIterator<AShooterCharacter> CharIt(World); CharIt; ++CharIt)
-            {
-                AShooterCharacter* Character = *CharIt;
-                if (Character && Character->Team != Team && Character->Team != EShooterTeam::None)
-                {
-                    float Distance = FVector::Dist(StartLocation, Character->GetActorLocation());
-                    if (Distance <= 1000.0f)
-                    {
-                        OccupiedStartPoints.RemoveAt(i);
-                        break; // No need to check more characters for this start point
-                    }
-                }
-            }
-        }
 
-		if (UnOccupiedStartPoints.Num() > 0)
-		{
-			FoundPlayerStart = UnOccupiedStartPoints[FMath::RandRange(0, UnOccupiedStartPoints.Num() - 1)];
-		}
-		else if (OccupiedStartPoints.Num() > 0)
-		{
-			FoundPlayerStart = OccupiedStartPoints[FMath::RandRange(0, OccupiedStartPoints.Num() - 1)];
-		}
-		else if (BackupStartPoints.Num() > 0)
+	TArray<APlayerStart*> BackupStartPoints;
+	for (APlayerStart* PlayerStart : SpawnRegistry->GetStartsWithTag("Backup"))
+	{
+		if (PlayerStart && (!Arena || Arena->ContainsLocation(PlayerStart->GetActorLocation())))
 		{
-			FoundPlayerStart = BackupStartPoints[FMath::RandRange(0, BackupStartPoints.Num() - 1)];
+			BackupStartPoints.Add(PlayerStart);
 		}
 	}
+
+	if (UnOccupiedStartPoints.Num() > 0)
+	{
+		FoundPlayerStart = UnOccupiedStartPoints[FMath::RandRange(0, UnOccupiedStartPoints.Num() - 1)];
+	}
+	else if (OccupiedStartPoints.Num() > 0)
+	{
+		FoundPlayerStart = OccupiedStartPoints[FMath::RandRange(0, OccupiedStartPoints.Num() - 1)];
+	}
+	else if (BackupStartPoints.Num() > 0)
+	{
+		FoundPlayerStart = BackupStartPoints[FMath::RandRange(0, BackupStartPoints.Num() - 1)];
+	}
+
 	return FoundPlayerStart;
 }
 
 bool AShooterGameMode::ReadyToEndMatch_Implementation()
 {
+	// Arenas run their own matches and never end the server's
+	if (UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		if (Arenas->HasArenas())
+		{
+			return false;
+		}
+	}
+
 	if (AShooterGameState* ShooterGameState = GetGameState<AShooterGameState>())
 	{
 		return ShooterGameState->RedTeamScore >= 10 || ShooterGameState->BlueTeamScore >= 10;
@@ -152,31 +146,147 @@ void AShooterGameMode::HandleMatchHasEnded()
 	if (AShooterGameState* ShooterGameState = GetGameState<AShooterGameState>())
 	{
 		// Determine winner and send alert
+		FShooterAlert Alert;
 		if (ShooterGameState->RedTeamScore >= 10)
 		{
-			ShooterGameState->MulticastOnAlert(TEXT("RED TEAM WINS"), FLinearColor::Red, 5.0f);
+			Alert.Type = EShooterAlert::RedTeamWins;
+			Alert.Color = EShooterAlertColor::Red;
+			ShooterGameState->SendAlert(Alert);
 		}
 		else if (ShooterGameState->BlueTeamScore >= 10)
 		{
-			ShooterGameState->MulticastOnAlert(TEXT("BLUE TEAM WINS"), FLinearColor::Blue, 5.0f);
+			Alert.Type = EShooterAlert::BlueTeamWins;
+			Alert.Color = EShooterAlertColor::Blue;
+			ShooterGameState->SendAlert(Alert);
 		}
         
-		// Set 5 second timer to restart the game
-		GetWorld()->GetTimerManager().SetTimer(RestartGameTimerHandle, this, 
-			&AShooterGameMode::RestartGame, 5.0f, false);
+		const FString NextMap = GetNextMap();
+
+		if (NextMap.IsEmpty())
+		{
+			// Set 5 second timer to reset the match in place
+			GetWorld()->GetTimerManager().SetTimer(ResetMatchTimerHandle, this, 
+				&AShooterGameMode::SoftResetMatch, 5.0f, false);
+		}
+		else
+		{
+			// Let everyone load the next map while the result is shown, then travel
+			ShooterGameState->SetNextMap(NextMap);
+
+			GetWorld()->GetTimerManager().SetTimer(ResetMatchTimerHandle, this, 
+				&AShooterGameMode::TravelToNextMap, 5.0f, false);
+		}
+	}
+}
+
+void AShooterGameMode::SoftResetMatch()
+{
+	// reset all actors through their Reset overrides instead of reloading the level.
+	// Pawns and projectiles are destroyed, pickups restored and scores cleared
+	ResetLevel();
+
+	// go back to the ready check. Players get new pawns when the match starts again
+	SetMatchState(MatchState::WaitingToStart);
+}
+
+FString AShooterGameMode::GetNextMap() const
+{
+	if (MapRotation.Num() == 0)
+	{
+		return FString();
+	}
+
+	const FString CurrentMap = UWorld::RemovePIEPrefix(GetWorld()->GetOutermost()->GetName());
+
+	// entries are long package names, possibly followed by travel options
+	auto GetPackageName = [](const FString& MapName)
+	{
+		FString PackageName = MapName;
+		PackageName.Split(TEXT("?"), &PackageName, nullptr);
+		return PackageName;
+	};
+
+	// the rotation wraps around. Start from the top if we're not on it
+	const int32 CurrentIndex = MapRotation.IndexOfByPredicate([&](const FString& MapName)
+	{
+		return GetPackageName(MapName) == CurrentMap;
+	});
+
+	const FString& NextMap = MapRotation[(CurrentIndex + 1) % MapRotation.Num()];
+
+	// staying on the same map is cheaper as a soft reset
+	return GetPackageName(NextMap) == CurrentMap ? FString() : NextMap;
+}
+
+void AShooterGameMode::TravelToNextMap()
+{
+	if (AShooterGameState* ShooterGameState = GetGameState<AShooterGameState>())
+	{
+		// seamless, so clients stay connected and keep their player states
+		GetWorld()->ServerTravel(ShooterGameState->NextMap);
 	}
 }
 
+void AShooterGameMode::Reset()
+{
+	Super::Reset();
+
+	TeamScores.Reset();
+
+	// the match start restarts every player
+	RespawnQueue.Reset();
+	SetActorTickEnabled(false);
+}
+
 AShooterGameMode::AShooterGameMode()
 {
 	PlayerStateClass = AShooterPlayerState::StaticClass();
 	GameStateClass = AShooterGameState::StaticClass();
 	bDelayedStart = true;
+
+	// keep clients connected across map changes
+	bUseSeamlessTravel = true;
+
+	// only tick while respawns are queued
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void AShooterGameMode::BeginPlay()
 {
 	Super::BeginPlay();
+
+	NormalizeMapRotation();
+}
+
+void AShooterGameMode::NormalizeMapRotation()
+{
+	for (int32 Index = MapRotation.Num() - 1; Index >= 0; --Index)
+	{
+		// travel URLs may carry options, keep them for the travel
+		FString PackageName;
+		FString Options;
+		if (!MapRotation[Index].Split(TEXT("?"), &PackageName, &Options))
+		{
+			PackageName = MapRotation[Index];
+		}
+
+		// resolve short names so comparisons and preloading only deal with long package names
+		if (!FPackageName::IsValidLongPackageName(PackageName))
+		{
+			FString LongPackageName;
+			if (!FPackageName::SearchForPackageOnDisk(PackageName, &LongPackageName))
+			{
+				UE_LOG(LogMulti, Warning, TEXT("Map %s in the rotation wasn't found, skipping it"), *MapRotation[Index]);
+				MapRotation.RemoveAt(Index);
+				continue;
+			}
+
+			PackageName = LongPackageName;
+		}
+
+		MapRotation[Index] = Options.IsEmpty() ? PackageName : PackageName + TEXT("?") + Options;
+	}
 }
 
 void AShooterGameMode::GenericPlayerInitialization(AController* C)
@@ -186,23 +296,206 @@ void AShooterGameMode::GenericPlayerInitialization(AController* C)
 	// Get the player state
 	if (AShooterPlayerState* PlayerState = C->GetPlayerState<AShooterPlayerState>())
 	{
-		// Check if player is already on a team
-		if (PlayerState->Team == EShooterTeam::None)
+		UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>();
+		UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>();
+
+		// Spectators join as observers
+		if (PlayerState->IsOnlyASpectator())
+		{
+			InitSpectator(Cast<APlayerController>(C));
+		}
+		// Arenas balance their own teams
+		else if (Arenas && Arenas->HasArenas())
+		{
+			if (!Arenas->AssignPlayer(PlayerState))
+			{
+				UE_LOG(LogMulti, Warning, TEXT("All arenas are full, %s will spectate"), *PlayerState->GetPlayerName());
+			}
+		}
+		// Check if player is already on a team. Players keep their team through seamless travel
+		else if (PlayerState->Team == EShooterTeam::None && Teams)
 		{
 			// Add to Red if Red has less players OR if it is a tie
-			if (RedTeamCount <= BlueTeamCount)
+			if (Teams->GetNumPlayers(EShooterTeam::Red) <= Teams->GetNumPlayers(EShooterTeam::Blue))
 			{
 				PlayerState->Team = EShooterTeam::Red;
-				RedTeamCount++;
 			}
 			// Otherwise, add them to Blue
 			else
 			{
 				PlayerState->Team = EShooterTeam::Blue;
-				BlueTeamCount++;
 			}
 		}
+
+		// Register the player on their team
+		if (Teams && !PlayerState->IsOnlyASpectator())
+		{
+			Teams->SetPlayerTeam(PlayerState, PlayerState->Team);
+		}
+
+		// Catch the player up on recent chat now that their team and arena are known
+		if (UShooterChatSubsystem* Chat = GetWorld()->GetSubsystem<UShooterChatSubsystem>())
+		{
+			Chat->SendHistory(PlayerState);
+		}
+	}
+}
+
+void AShooterGameMode::InitSpectator(APlayerController* Spectator)
+{
+	if (!Spectator)
+	{
+		return;
+	}
+
+	// the game state adds a row for every player state before it knows it's a spectator
+	if (AShooterGameState* ShooterGameState = GetGameState<AShooterGameState>())
+	{
+		ShooterGameState->Scoreboard.RemovePlayer(Spectator->PlayerState);
+
+		// it was also counted as an unready player, which cancels a running countdown
+		ShooterGameState->UpdateMatchCountdown();
+	}
+
+	// spectators send and receive little of their own, so update them rarely
+	Spectator->SetNetUpdateFrequency(SpectatorNetUpdateFrequency);
+
+	if (Spectator->PlayerState)
+	{
+		Spectator->PlayerState->SetNetUpdateFrequency(SpectatorNetUpdateFrequency);
+
+		UE_LOG(LogMulti, Log, TEXT("%s joined as a spectator"), *Spectator->PlayerState->GetPlayerName());
+	}
+
+	// cap the spectator's bandwidth so a caster costs a fraction of a player
+	if (UNetConnection* Connection = Spectator->GetNetConnection())
+	{
+		Connection->CurrentNetSpeed = FMath::Min(Connection->CurrentNetSpeed, SpectatorNetSpeed);
+	}
+}
+
+void AShooterGameMode::ClampSpectatorNetSpeeds()
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!PC || !PC->PlayerState || !PC->PlayerState->IsOnlyASpectator())
+		{
+			continue;
+		}
+
+		// a netspeed command from the client overwrites the speed set on join
+		if (UNetConnection* Connection = PC->GetNetConnection())
+		{
+			Connection->CurrentNetSpeed = FMath::Min(Connection->CurrentNetSpeed, SpectatorNetSpeed);
+		}
+	}
+}
+
+void AShooterGameMode::InitializeHUDForPlayer_Implementation(APlayerController* NewPlayer)
+{
+	// the HUD classes live in the client module, which dedicated servers don't load
+	if (AShooterPlayerController* ShooterPC = Cast<AShooterPlayerController>(NewPlayer))
+	{
+		ShooterPC->ClientSetShooterHUD(NewPlayer->PlayerState && NewPlayer->PlayerState->IsOnlyASpectator());
+		return;
+	}
+
+	Super::InitializeHUDForPlayer_Implementation(NewPlayer);
+}
+
+bool AShooterGameMode::CanSpectate_Implementation(APlayerController* Viewer, APlayerState* ViewTarget)
+{
+	return ViewTarget && !ViewTarget->IsOnlyASpectator() && ViewTarget->GetPawn();
+}
+
+void AShooterGameMode::QueueRespawn(AController* Controller)
+{
+	if (!Controller)
+	{
+		return;
+	}
+
+	// respawns become due in order, so appending keeps the queue sorted by wait time
+	RespawnQueue.AddUnique(Controller);
+
+	SetActorTickEnabled(true);
+}
+
+void AShooterGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = RespawnFrameBudgetMs * 0.001;
+
+	int32 Processed = 0;
+	int32 Respawned = 0;
+
+	while (Processed < RespawnQueue.Num() && Respawned < MaxRespawnsPerFrame)
+	{
+		// stop once the budget is spent, but always make progress
+		if (Respawned > 0 && FPlatformTime::Seconds() - StartTime > Budget)
+		{
+			break;
+		}
+
+		AController* Controller = RespawnQueue[Processed++].Get();
+
+		// skip controllers that left or were already given a pawn
+		if (!IsValid(Controller) || Controller->GetPawn())
+		{
+			continue;
+		}
+
+		RestartPlayer(Controller);
+		Respawned++;
+	}
+
+	RespawnQueue.RemoveAt(0, Processed);
+
+	if (RespawnQueue.Num() == 0)
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+bool AShooterGameMode::PlayerCanRestart_Implementation(APlayerController* Player)
+{
+	// Players that didn't fit in any arena stay spectators
+	if (UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		if (Arenas->HasArenas() && Arenas->GetArenaIndexFor(Player) == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+
+	return Super::PlayerCanRestart_Implementation(Player);
+}
+
+void AShooterGameMode::Logout(AController* Exiting)
+{
+	if (AShooterPlayerState* PlayerState = Exiting->GetPlayerState<AShooterPlayerState>())
+	{
+		// Keep the team counts right for the players that join later
+		if (UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>())
+		{
+			Teams->RemovePlayer(PlayerState);
+		}
+
+		if (UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+		{
+			Arenas->ReleasePlayer(PlayerState);
+		}
+
+		if (UShooterChatSubsystem* Chat = GetWorld()->GetSubsystem<UShooterChatSubsystem>())
+		{
+			Chat->RemovePlayer(PlayerState);
+		}
 	}
+
+	Super::Logout(Exiting);
 }
 
 void AShooterGameMode::IncrementTeamScore(uint8 TeamByte)
@@ -8,12 +8,11 @@
 #include "GameFramework/GameMode.h"
 #include "ShooterGameMode.generated.h"
 
-class UShooterUI;
-
 /**
  *  Simple GameMode for a first person shooter game
  *  Manages game UI
  *  Keeps track of team scores
+ *  Spreads player respawns across frames
  */
 UCLASS(abstract)
 class MULTI_API AShooterGameMode : public AGameMode
@@ -29,9 +28,17 @@ protected:
 
 	virtual void GenericPlayerInitialization(AController* C) override;
 
-	int32 RedTeamCount = 0;
+	/** Lets shooter controllers pick the player or spectator HUD on the client */
+	virtual void InitializeHUDForPlayer_Implementation(APlayerController* NewPlayer) override;
+
+	/** Lets spectators only follow players that are in the match */
+	virtual bool CanSpectate_Implementation(APlayerController* Viewer, APlayerState* ViewTarget) override;
+
+	/** Keeps players without an arena from spawning */
+	virtual bool PlayerCanRestart_Implementation(APlayerController* Player) override;
 
-	int32 BlueTeamCount = 0;
+	/** Takes the player out of their team and arena */
+	virtual void Logout(AController* Exiting) override;
 
 	virtual bool ShouldSpawnAtStartSpot(AController* Player) override;
 
@@ -41,6 +48,47 @@ protected:
 
 	virtual void HandleMatchHasEnded() override;
 
+	/** Resets the level in place and returns to the ready check, without a travel */
+	void SoftResetMatch();
+
+	/** Clears the team scores and pending respawns */
+	virtual void Reset() override;
+
+	/** Maps to rotate through, as short or long package names with optional travel options. The match resets in place when there's no other map to go to */
+	UPROPERTY(EditDefaultsOnly, Category="Travel")
+	TArray<FString> MapRotation;
+
+	/** Resolves the rotation entries to long package names, dropping the ones that don't exist */
+	void NormalizeMapRotation();
+
+	/** Returns the map after the current one in the rotation, or an empty string */
+	FString GetNextMap() const;
+
+	/** Seamlessly travels to the next map */
+	void TravelToNextMap();
+
+	/** Max number of players respawned in a single frame */
+	UPROPERTY(EditDefaultsOnly, Category="Respawn", meta = (ClampMin = 1, ClampMax = 16))
+	int32 MaxRespawnsPerFrame = 2;
+
+	/** Time budget for respawns in a single frame. At least one respawn always runs */
+	UPROPERTY(EditDefaultsOnly, Category="Respawn", meta = (ClampMin = 0, ClampMax = 10, Units = "ms"))
+	float RespawnFrameBudgetMs = 2.0f;
+
+	/** Bandwidth cap for spectator connections, in bytes per second. Actors update less often for spectators when it's reached */
+	UPROPERTY(EditDefaultsOnly, Category="Spectator", meta = (ClampMin = 1000))
+	int32 SpectatorNetSpeed = 5000;
+
+	/** Net update frequency of spectator controllers and player states */
+	UPROPERTY(EditDefaultsOnly, Category="Spectator", meta = (ClampMin = 1, Units = "Hz"))
+	float SpectatorNetUpdateFrequency = 2.0f;
+
+	/** Sets up a spectator. They stay out of teams, arenas and the scoreboard, and get a throttled connection */
+	void InitSpectator(APlayerController* Spectator);
+
+	/** Processes the respawn queue */
+	virtual void Tick(float DeltaSeconds) override;
+
 public:
 	/** Constructor */
 	AShooterGameMode();
@@ -48,11 +96,20 @@ public:
 	/** Increases the score for the given team */
 	void IncrementTeamScore(uint8 TeamByte);
 
+	/** Caps the bandwidth of every spectator connection. Clients can raise their net speed at any time, so this runs periodically */
+	void ClampSpectatorNetSpeeds();
+
+	/** Queues the controller for a respawn. Longest waiting controllers are respawned first */
+	void QueueRespawn(AController* Controller);
+
 	// Time before the match wills tart
 	UPROPERTY(EditDefaultsOnly)
 	float WaitingToStartDuration = 5.0f;
 
 private:
-	FTimerHandle RestartGameTimerHandle;
+	FTimerHandle ResetMatchTimerHandle;
+
+	/** Controllers waiting for a respawn, longest waiting first */
+	TArray<TWeakObjectPtr<AController>> RespawnQueue;
 
 };
@@ -0,0 +1,76 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Engine/NetSerialization.h"
+#include "ShooterPlayerState.h"
+#include "ShooterHUDListener.generated.h"
+
+/**
+ *  Hits a player landed during one server frame, sent in a single RPC
+ */
+USTRUCT()
+struct MULTI_API FShooterHitFeedback
+{
+	GENERATED_BODY()
+
+	/** Number of hits */
+	UPROPERTY()
+	uint8 Hits = 0;
+
+	/** Number of hits that were headshots */
+	UPROPERTY()
+	uint8 Headshots = 0;
+
+	/** Number of kills */
+	UPROPERTY()
+	uint8 Kills = 0;
+
+	/** Total damage dealt, rounded */
+	UPROPERTY()
+	uint16 Damage = 0;
+
+	/** Location of the last hit, for the damage number */
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+};
+
+UINTERFACE(MinimalAPI)
+class UShooterHUDListener : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ *  Gameplay events shown on the HUD
+ *  Implemented by the HUD in the client module, so gameplay code never depends on UI code and dedicated servers don't load it
+ */
+class MULTI_API IShooterHUDListener
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Updates the ammo counter */
+	virtual void UpdateBulletCounter(int32 MagazineSize, int32 Bullets) = 0;
+
+	/** Updates the life bar and plays the damage effect */
+	virtual void ShowDamage(float LifePercent) = 0;
+
+	/** Shows an alert message */
+	virtual void ShowAlert(const FString& Text, FLinearColor Color, float Duration) = 0;
+
+	/** Shows the hit marker and damage number for hits the player landed */
+	virtual void ShowHitFeedback(const FShooterHitFeedback& Feedback) = 0;
+
+	/** Shows the death screen with the respawn countdown */
+	virtual void ShowDeathScreen(float RespawnTime) = 0;
+
+	/** Adds a line to the chat */
+	virtual void AddChatMessage(EShooterTeam Team, const FString& SenderName, const FString& Message) = 0;
+
+	/** Opens the chat entry box */
+	virtual void StartChatInput(bool bTeamOnly) = 0;
+};
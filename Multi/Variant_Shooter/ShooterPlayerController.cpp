@@ -9,37 +9,21 @@
 #include "GameFramework/PlayerStart.h"
 #include "EnhancedInputComponent.h"
 #include "ShooterCharacter.h"
-#include "ShooterBulletCounterUI.h"
-#include "Multi.h"
+#include "ShooterHUDListener.h"
+#include "ShooterClockSyncComponent.h"
+#include "MultiCameraManager.h"
+#include "GameFramework/HUD.h"
 #include "ShooterPlayerState.h"
-#include "Blueprint/WidgetBlueprintLibrary.h"
+#include "TimerManager.h"
 #include "Widgets/Input/SVirtualJoystick.h"
 
-void AShooterPlayerController::BeginPlay()
+AShooterPlayerController::AShooterPlayerController()
 {
-	Super::BeginPlay();
+	// create the clock sync component
+	ClockSync = CreateDefaultSubobject<UShooterClockSyncComponent>(TEXT("Clock Sync"));
 
-	// only spawn touch controls on local player controllers
-	if (IsLocalPlayerController())
-	{
-		// create the bullet counter widget and add it to the screen
-		BulletCounterUI = CreateWidget<UShooterBulletCounterUI>(this, BulletCounterUIClass);
-
-		if (BulletCounterUI)
-		{
-			BulletCounterUI->SetOwningPlayer(this);
-			BulletCounterUI->AddToPlayerScreen(0);
-
-			// set the input mode to game only
-			FInputModeUIOnly InputMode;
-			SetInputMode(InputMode);
-			SetShowMouseCursor(true);
-		}
-		else
-		{
-			UE_LOG(LogMulti, Error, TEXT("Could not spawn bullet counter widget."));
-		}
-	}
+	// set the player camera manager class. It predicts weapon recoil
+	PlayerCameraManagerClass = AMultiCameraManager::StaticClass();
 }
 
 void AShooterPlayerController::SetupInputComponent()
@@ -71,6 +55,8 @@ void AShooterPlayerController::SetupInputComponent()
 		{
 			EnhancedInputComponent->BindAction(ChatAllAction, ETriggerEvent::Started, this, &AShooterPlayerController::OnChatAllPressed);
 			EnhancedInputComponent->BindAction(ChatTeamAction, ETriggerEvent::Started, this, &AShooterPlayerController::OnChatTeamPressed);
+			EnhancedInputComponent->BindAction(SpectateNextAction, ETriggerEvent::Started, this, &AShooterPlayerController::OnSpectateNextPressed);
+			EnhancedInputComponent->BindAction(SpectatePreviousAction, ETriggerEvent::Started, this, &AShooterPlayerController::OnSpectatePreviousPressed);
 		}
 	}
 }
@@ -96,26 +82,76 @@ void AShooterPlayerController::OnPossess(APawn* InPawn)
 	SetupDelegates();
 }
 
+void AShooterPlayerController::AddHitFeedback(float Damage, bool bHeadshot, bool bKill, const FVector& Location)
+{
+	// send everything landed this frame in one go
+	if (PendingHitFeedback.Hits == 0)
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &AShooterPlayerController::FlushHitFeedback);
+	}
+
+	// saturate instead of wrapping on absurd frames
+	PendingHitFeedback.Hits = FMath::Min<int32>(PendingHitFeedback.Hits + 1, MAX_uint8);
+	PendingHitFeedback.Headshots = FMath::Min<int32>(PendingHitFeedback.Headshots + (bHeadshot ? 1 : 0), MAX_uint8);
+	PendingHitFeedback.Kills = FMath::Min<int32>(PendingHitFeedback.Kills + (bKill ? 1 : 0), MAX_uint8);
+	PendingHitFeedback.Damage = FMath::Min<int32>(PendingHitFeedback.Damage + FMath::RoundToInt(FMath::Max(Damage, 0.0f)), MAX_uint16);
+	PendingHitFeedback.Location = Location;
+}
+
+void AShooterPlayerController::FlushHitFeedback()
+{
+	if (PendingHitFeedback.Hits > 0)
+	{
+		ClientHitFeedback(PendingHitFeedback);
+	}
+
+	PendingHitFeedback = FShooterHitFeedback();
+}
+
+void AShooterPlayerController::ClientHitFeedback_Implementation(const FShooterHitFeedback& Feedback)
+{
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
+	{
+		ShooterHUD->ShowHitFeedback(Feedback);
+	}
+}
+
+IShooterHUDListener* AShooterPlayerController::GetShooterHUD() const
+{
+	return Cast<IShooterHUDListener>(GetHUD());
+}
+
 void AShooterPlayerController::OnPawnDestroyed(AActor* DestroyedActor)
 {
 	// reset the bullet counter HUD
-	BulletCounterUI->BP_UpdateBulletCounter(0, 0);
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
+	{
+		ShooterHUD->UpdateBulletCounter(0, 0);
+	}
 }
 
 void AShooterPlayerController::OnBulletCountUpdated(int32 MagazineSize, int32 Bullets)
 {
 	// update the UI
-	if (BulletCounterUI)
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
 	{
-		BulletCounterUI->BP_UpdateBulletCounter(MagazineSize, Bullets);
+		ShooterHUD->UpdateBulletCounter(MagazineSize, Bullets);
 	}
 }
 
 void AShooterPlayerController::OnPawnDamaged(float LifePercent)
 {
-	if (IsValid(BulletCounterUI))
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
+	{
+		ShooterHUD->ShowDamage(LifePercent);
+	}
+}
+
+void AShooterPlayerController::OnPawnDeath(float RespawnTime)
+{
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
 	{
-		BulletCounterUI->BP_Damaged(LifePercent);
+		ShooterHUD->ShowDeathScreen(RespawnTime);
 	}
 }
 
@@ -128,25 +164,41 @@ void AShooterPlayerController::OnRep_Pawn()
 
 void AShooterPlayerController::OnAlert(const FString& Text, FLinearColor Color, float Duration)
 {
-	if (BulletCounterUI)
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
 	{
-		BulletCounterUI->ShowAlert(Text, Color, Duration);
+		ShooterHUD->ShowAlert(Text, Color, Duration);
 	}
 }
 
 void AShooterPlayerController::OnChatAllPressed()
 {
-	if (BulletCounterUI)
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
 	{
-		BulletCounterUI->StartChatInput(false);
+		ShooterHUD->StartChatInput(false);
 	}
 }
 
 void AShooterPlayerController::OnChatTeamPressed()
 {
-	if (BulletCounterUI)
+	if (IShooterHUDListener* ShooterHUD = GetShooterHUD())
+	{
+		ShooterHUD->StartChatInput(true);
+	}
+}
+
+void AShooterPlayerController::OnSpectateNextPressed()
+{
+	if (PlayerState && PlayerState->IsOnlyASpectator())
+	{
+		ServerViewNextPlayer();
+	}
+}
+
+void AShooterPlayerController::OnSpectatePreviousPressed()
+{
+	if (PlayerState && PlayerState->IsOnlyASpectator())
 	{
-		BulletCounterUI->StartChatInput(true);
+		ServerViewPrevPlayer();
 	}
 }
 
@@ -164,7 +216,7 @@ void AShooterPlayerController::SetupDelegates()
 			ShooterCharacter->OnBulletCountUpdated.AddUniqueDynamic(this, &AShooterPlayerController::OnBulletCountUpdated);
 			ShooterCharacter->OnDamaged.AddUniqueDynamic(this, &AShooterPlayerController::OnPawnDamaged);
 
-			ShooterCharacter->OnDeath.AddUniqueDynamic(BulletCounterUI, &UShooterBulletCounterUI::ShowDeathScreen);
+			ShooterCharacter->OnDeath.AddUniqueDynamic(this, &AShooterPlayerController::OnPawnDeath);
 
 			// force update the life bar
 			ShooterCharacter->OnDamaged.Broadcast(1.0f);
@@ -175,6 +227,24 @@ void AShooterPlayerController::SetupDelegates()
 void AShooterPlayerController::ClientOnPossess_Implementation()
 {
 	// Switch to game-only input mode when we possess a pawn (game starts)
-	UWidgetBlueprintLibrary::SetInputMode_GameOnly(this);
+	FInputModeGameOnly InputMode;
+	SetInputMode(InputMode);
 	SetShowMouseCursor(false);
 }
+
+void AShooterPlayerController::ClientSetShooterHUD_Implementation(bool bSpectator)
+{
+	UClass* NewHUDClass = bSpectator ? SpectatorHUDClass.LoadSynchronous() : PlayerHUDClass.LoadSynchronous();
+
+	ClientSetHUD_Implementation(NewHUDClass ? NewHUDClass : AHUD::StaticClass());
+}
+
+void AShooterPlayerController::ClientGameplayCues_Implementation(const TArray<FShooterGameplayCue>& Cues)
+{
+	UShooterGameplayCueSubsystem::PlayCues(Cues);
+}
+
+void AShooterPlayerController::ClientCriticalGameplayCues_Implementation(const TArray<FShooterGameplayCue>& Cues)
+{
+	UShooterGameplayCueSubsystem::PlayCues(Cues);
+}
@@ -4,21 +4,29 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "ShooterGameplayCueSubsystem.h"
+#include "ShooterHUDListener.h"
 #include "ShooterPlayerController.generated.h"
 
 class UInputMappingContext;
 class AShooterCharacter;
-class UShooterBulletCounterUI;
+class UShooterClockSyncComponent;
+class AHUD;
 
 /**
  *  Simple PlayerController for a first person shooter game
  *  Manages input mappings
  *  Respawns the player pawn when it's destroyed
+ *  Picks its HUD on the client, since dedicated servers don't load the client module
  */
-UCLASS(abstract)
+UCLASS(abstract, Config=Game)
 class MULTI_API AShooterPlayerController : public APlayerController
 {
 	GENERATED_BODY()
+
+	/** Estimates the server clock for this player */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
+	UShooterClockSyncComponent* ClockSync;
 	
 protected:
 
@@ -30,28 +38,22 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Input|Input Mappings")
 	TArray<UInputMappingContext*> MobileExcludedMappingContexts;
 
-	/** Mobile controls widget to spawn */
-	UPROPERTY(EditAnywhere, Category="Input|Touch Controls")
-	TSubclassOf<UUserWidget> MobileControlsWidgetClass;
-
-	/** Pointer to the mobile controls widget */
-	TObjectPtr<UUserWidget> MobileControlsWidget;
-
 	/** Character class to respawn when the possessed pawn is destroyed */
 	UPROPERTY(EditAnywhere, Category="Shooter|Respawn")
 	TSubclassOf<AShooterCharacter> CharacterClass;
 
-	/** Type of bullet counter UI widget to spawn */
-	UPROPERTY(EditAnywhere, Category="Shooter|UI")
-	TSubclassOf<UShooterBulletCounterUI> BulletCounterUIClass;
+	/** HUD for players. Set in config so the server never has to resolve a MultiClient class */
+	UPROPERTY(Config, EditDefaultsOnly, Category="Shooter|HUD")
+	TSoftClassPtr<AHUD> PlayerHUDClass;
+
+	/** HUD for players joining with ?SpectatorOnly=1. Falls back to a bare HUD so casters and admins don't load the player widgets */
+	UPROPERTY(Config, EditDefaultsOnly, Category="Shooter|HUD")
+	TSoftClassPtr<AHUD> SpectatorHUDClass;
 
 	/** Tag to grant the possessed pawn to flag it as the player */
 	UPROPERTY(EditAnywhere, Category="Shooter|Player")
 	FName PlayerPawnTag = FName("Player");
 
-	/** Gameplay Initialization */
-	virtual void BeginPlay() override;
-
 	/** Initialize input bindings */
 	virtual void SetupInputComponent() override;
 
@@ -70,14 +72,37 @@ protected:
 	UFUNCTION()
 	void OnPawnDamaged(float LifePercent);
 
+	/** Called when the possessed pawn dies */
+	UFUNCTION()
+	void OnPawnDeath(float RespawnTime);
+
 	virtual void OnRep_Pawn() override;
 
+	/** Hits landed this frame, not sent yet */
+	FShooterHitFeedback PendingHitFeedback;
+
+	/** Sends the hits landed this frame */
+	void FlushHitFeedback();
+
+	/** Shows the hits landed during a server frame */
+	UFUNCTION(Client, Unreliable)
+	void ClientHitFeedback(const FShooterHitFeedback& Feedback);
+
 public:
+	/** Constructor */
+	AShooterPlayerController();
+
+	/** Returns the clock sync component */
+	UShooterClockSyncComponent* GetClockSync() const { return ClockSync; }
+
 	UFUNCTION()
 	void OnAlert(const FString& Text, FLinearColor Color, float Duration);
 
-	/** Pointer to the bullet counter UI widget */
-	TObjectPtr<UShooterBulletCounterUI> BulletCounterUI;
+	/** Adds a hit this player landed. Hits are sent together at the end of the frame */
+	void AddHitFeedback(float Damage, bool bHeadshot, bool bKill, const FVector& Location);
+
+	/** Returns the HUD, if it shows gameplay events. Null on dedicated servers and for remote players */
+	IShooterHUDListener* GetShooterHUD() const;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
 	class UInputAction* ChatAllAction;
@@ -91,9 +116,35 @@ public:
 	UFUNCTION()
 	void OnChatTeamPressed();
 
+	/** Spectators follow the next player */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	class UInputAction* SpectateNextAction;
+
+	/** Spectators follow the previous player */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	class UInputAction* SpectatePreviousAction;
+
+	UFUNCTION()
+	void OnSpectateNextPressed();
+
+	UFUNCTION()
+	void OnSpectatePreviousPressed();
+
 	UFUNCTION(Client, Reliable)
 	void ClientOnPossess();
 
+	/** Spawns the player or spectator HUD from the classes set on this client */
+	UFUNCTION(Client, Reliable)
+	void ClientSetShooterHUD(bool bSpectator);
+
+	/** Plays the cosmetic cues raised on the server this frame */
+	UFUNCTION(Client, Unreliable)
+	void ClientGameplayCues(const TArray<FShooterGameplayCue>& Cues);
+
+	/** Plays the critical cues raised on the server this frame for actors this player owns */
+	UFUNCTION(Client, Reliable)
+	void ClientCriticalGameplayCues(const TArray<FShooterGameplayCue>& Cues);
+
 	UFUNCTION()
 	void SetupDelegates();
 };
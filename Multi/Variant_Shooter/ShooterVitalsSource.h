@@ -0,0 +1,42 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "ShooterVitalsSource.generated.h"
+
+/**
+ *  Values shown by the native ammo counter and health bar
+ */
+struct FShooterVitals
+{
+	/** Bullets left in the magazine */
+	int32 Bullets = 0;
+
+	/** Magazine size of the current weapon, or 0 without a weapon */
+	int32 MagazineSize = 0;
+
+	/** Remaining life, from 0 to 1 */
+	float LifePercent = 0.0f;
+};
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UShooterVitalsSource : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ *  Native source of ammo and life for the HUD
+ *  Polled by the HUD every frame, so it never goes through delegates or Blueprint
+ */
+class MULTI_API IShooterVitalsSource
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Returns the current ammo and life */
+	virtual FShooterVitals GetVitals() const = 0;
+};
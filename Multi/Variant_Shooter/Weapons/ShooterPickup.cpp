@@ -65,7 +65,25 @@ void AShooterPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 
 	// clear the respawn timer
-	GetWorld()->GetTimerManager().ClearTimer(RespawnTimer);
+	if (UShooterFixedStepSubsystem* FixedStep = GetWorld()->GetSubsystem<UShooterFixedStepSubsystem>())
+	{
+		FixedStep->ClearTimer(RespawnTimer);
+	}
+}
+
+void AShooterPickup::Reset()
+{
+	Super::Reset();
+
+	// cancel any pending respawn
+	if (UShooterFixedStepSubsystem* FixedStep = GetWorld()->GetSubsystem<UShooterFixedStepSubsystem>())
+	{
+		FixedStep->ClearTimer(RespawnTimer);
+	}
+
+	// show the pickup right away, skipping the respawn animation
+	SetActorHiddenInGame(false);
+	FinishRespawn();
 }
 
 void AShooterPickup::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -84,8 +102,11 @@ void AShooterPickup::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor*
 		// disable ticking
 		SetActorTickEnabled(false);
 
-		// schedule the respawn
-		GetWorld()->GetTimerManager().SetTimer(RespawnTimer, this, &AShooterPickup::RespawnPickup, RespawnTime, false);
+		// schedule the respawn on the fixed step
+		if (UShooterFixedStepSubsystem* FixedStep = GetWorld()->GetSubsystem<UShooterFixedStepSubsystem>())
+		{
+			FixedStep->SetTimer(RespawnTimer, FSimpleDelegate::CreateUObject(this, &AShooterPickup::RespawnPickup), RespawnTime);
+		}
 	}
 }
 
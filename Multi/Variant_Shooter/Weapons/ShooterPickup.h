@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "Engine/DataTable.h"
 #include "Engine/StaticMesh.h"
+#include "ShooterFixedStepSubsystem.h"
 #include "ShooterPickup.generated.h"
 
 class USphereComponent;
@@ -58,8 +59,8 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Pickup", meta = (ClampMin = 0, ClampMax = 120, Units = "s"))
 	float RespawnTime = 4.0f;
 
-	/** Timer to respawn the pickup */
-	FTimerHandle RespawnTimer;
+	/** Fixed step timer to respawn the pickup */
+	FShooterStepTimerHandle RespawnTimer;
 
 public:	
 	
@@ -77,6 +78,9 @@ protected:
 	/** Gameplay cleanup */
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	/** Makes the pickup available again for a soft match reset */
+	virtual void Reset() override;
+
 	/** Handles collision overlap */
 	UFUNCTION()
 	virtual void OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
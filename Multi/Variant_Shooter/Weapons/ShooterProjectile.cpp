@@ -4,6 +4,8 @@
 #include "ShooterProjectile.h"
 
 #include "ShooterCharacter.h"
+#include "ShooterArenaSubsystem.h"
+#include "ShooterTeamSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "GameFramework/Character.h"
@@ -34,6 +36,11 @@ AShooterProjectile::AShooterProjectile()
 	ProjectileMovement->MaxSpeed = 3000.0f;
 	ProjectileMovement->bShouldBounce = true;
 
+	// simulate in fixed 60Hz sub-steps so trajectories don't depend on frame rate
+	ProjectileMovement->bForceSubStepping = true;
+	ProjectileMovement->MaxSimulationTimeStep = 1.0f / 60.0f;
+	ProjectileMovement->MaxSimulationIterations = 8;
+
 	// set the default damage type
 	HitDamageType = UDamageType::StaticClass();
 
@@ -46,6 +53,12 @@ void AShooterProjectile::BeginPlay()
 	
 	// ignore the pawn that shot this projectile
 	CollisionComponent->IgnoreActorWhenMoving(GetInstigator(), true);
+
+	// dead pawns leave the team registry, so remember the shooter's team now
+	if (UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>())
+	{
+		InstigatorTeam = Teams->GetTeam(GetInstigator());
+	}
 }
 
 void AShooterProjectile::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -87,7 +100,7 @@ void AShooterProjectile::NotifyHit(class UPrimitiveComponent* MyComp, AActor* Ot
 	} else {
 
 		// single hit projectile. Process the collided actor
-		ProcessHit(Other, OtherComp, Hit.ImpactPoint, -Hit.ImpactNormal);
+		ProcessHit(Other, OtherComp, Hit.ImpactPoint, -Hit.ImpactNormal, &Hit);
 
 	}
 
@@ -149,19 +162,16 @@ void AShooterProjectile::ExplosionCheck(const FVector& ExplosionCenter)
 	}
 }
 
-void AShooterProjectile::ProcessHit(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection)
+void AShooterProjectile::ProcessHit(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection, const FHitResult* DirectHit)
 {
 	if (!bAllowFriendlyFire)
 	{
-		if (AShooterCharacter* HitCharacter = Cast<AShooterCharacter>(HitActor))
+		if (UShooterTeamSubsystem* Teams = GetWorld()->GetSubsystem<UShooterTeamSubsystem>())
 		{
-			if (AShooterCharacter* InstigatorCharacter = Cast<AShooterCharacter>(GetInstigator()))
+			// Don't apply damage if both characters are on the same team
+			if (InstigatorTeam != EShooterTeam::None && Teams->GetTeam(HitActor) == InstigatorTeam)
 			{
-				// Don't apply damage if both characters are on the same team
-				if (HitCharacter->Team == InstigatorCharacter->Team)
-				{
-					return; // Exit early, no damage to teammates
-				}
+				return; // Exit early, no damage to teammates
 			}
 		}
 	}
@@ -172,8 +182,15 @@ void AShooterProjectile::ProcessHit(AActor* HitActor, UPrimitiveComponent* HitCo
 		// ignore the owner of this projectile
 		if (HitCharacter != GetOwner() || bDamageOwner)
 		{
-			// apply damage to the character
-			UGameplayStatics::ApplyDamage(HitCharacter, HitDamage, GetInstigator()->GetController(), this, HitDamageType);
+			// apply damage to the character. Direct hits carry the hit location for headshots
+			if (DirectHit)
+			{
+				UGameplayStatics::ApplyPointDamage(HitCharacter, HitDamage, HitDirection, *DirectHit, GetInstigator()->GetController(), this, HitDamageType);
+			}
+			else
+			{
+				UGameplayStatics::ApplyDamage(HitCharacter, HitDamage, GetInstigator()->GetController(), this, HitDamageType);
+			}
 		}
 	}
 
@@ -190,3 +207,23 @@ void AShooterProjectile::OnDeferredDestruction()
 	// destroy this actor
 	Destroy();
 }
+
+void AShooterProjectile::Reset()
+{
+	// projectiles don't survive a match reset
+	Destroy();
+}
+
+bool AShooterProjectile::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	// players in other arenas never see this projectile
+	if (const UShooterArenaSubsystem* Arenas = GetWorld()->GetSubsystem<UShooterArenaSubsystem>())
+	{
+		if (!Arenas->IsRelevantInArena(this, RealViewer, ViewTarget))
+		{
+			return false;
+		}
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
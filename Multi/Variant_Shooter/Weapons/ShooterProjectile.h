@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "ShooterPlayerState.h"
 #include "ShooterProjectile.generated.h"
 
 class USphereComponent;
@@ -65,6 +66,12 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Projectile|Explosion", meta = (ClampMin = 0, ClampMax = 5000, Units = "cm"))
 	float ExplosionRadius = 500.0f;	
 
+	/** Kill feed ID of the weapon that fired this projectile */
+	uint8 KillFeedWeaponId = 0;
+
+	/** Team of the pawn that fired this projectile, cached at spawn so it still counts if they die before it lands */
+	EShooterTeam InstigatorTeam = EShooterTeam::None;
+
 	/** If true, this projectile has already hit another surface */
 	bool bHit = false;
 
@@ -87,8 +94,8 @@ protected:
 	/** Looks up actors within the explosion radius and damages them */
 	void ExplosionCheck(const FVector& ExplosionCenter);
 
-	/** Processes a projectile hit for the given actor */
-	void ProcessHit(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection);
+	/** Processes a projectile hit for the given actor. Direct hits apply point damage */
+	void ProcessHit(AActor* HitActor, UPrimitiveComponent* HitComp, const FVector& HitLocation, const FVector& HitDirection, const FHitResult* DirectHit = nullptr);
 
 	/** Passes control to Blueprint to implement any effects on hit. */
 	UFUNCTION(BlueprintImplementableEvent, Category="Projectile", meta = (DisplayName = "On Projectile Hit"))
@@ -97,6 +104,12 @@ protected:
 	/** Called from the destruction timer to destroy this projectile */
 	void OnDeferredDestruction();
 
+	/** Destroys the projectile for a soft match reset */
+	virtual void Reset() override;
+
+	/** Hides the projectile from players in other arenas */
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 public:
 	
 	/** Constructor */
@@ -105,4 +118,10 @@ public:
 	UPROPERTY(EditDefaultsOnly)
 	bool bAllowFriendlyFire = false;
 
+	/** Sets the kill feed ID of the weapon that fired this projectile */
+	void SetKillFeedWeaponId(uint8 WeaponId) { KillFeedWeaponId = WeaponId; }
+
+	/** Returns the kill feed ID of the weapon that fired this projectile */
+	uint8 GetKillFeedWeaponId() const { return KillFeedWeaponId; }
+
 };
@@ -4,6 +4,8 @@
 #include "ShooterWeapon.h"
 
 #include "ShooterCharacter.h"
+#include "ShooterSignificanceSubsystem.h"
+#include "ShooterGameplayCueSubsystem.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/World.h"
 #include "ShooterProjectile.h"
@@ -39,6 +41,9 @@ AShooterWeapon::AShooterWeapon()
 	ThirdPersonMesh->bOwnerNoSee = true;
 
 	SetReplicates(true);
+
+	// weapons are relevant wherever their owner is, which keeps them inside the owner's arena
+	bNetUseOwnerRelevancy = true;
 }
 
 void AShooterWeapon::BeginPlay()
@@ -64,7 +69,10 @@ void AShooterWeapon::EndPlay(EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 
 	// clear the refire timer
-	GetWorld()->GetTimerManager().ClearTimer(RefireTimer);
+	if (UShooterFixedStepSubsystem* FixedStep = GetFixedStep())
+	{
+		FixedStep->ClearTimer(RefireTimer);
+	}
 }
 
 void AShooterWeapon::OnOwnerDestroyed(AActor* DestroyedActor)
@@ -99,9 +107,16 @@ void AShooterWeapon::StartFiring()
 	// raise the firing flag
 	bIsFiring = true;
 
+	// shots are timed on the fixed step, so we can't fire without it
+	UShooterFixedStepSubsystem* FixedStep = GetFixedStep();
+	if (!FixedStep)
+	{
+		return;
+	}
+
 	// check how much time has passed since we last shot
 	// this may be under the refire rate if the weapon shoots slow enough and the player is spamming the trigger
-	const float TimeSinceLastShot = GetWorld()->GetTimeSeconds() - TimeOfLastShot;
+	const float TimeSinceLastShot = FixedStep->GetSimulationTime() - TimeOfLastShot;
 
 	if (TimeSinceLastShot > RefireRate)
 	{
@@ -110,10 +125,10 @@ void AShooterWeapon::StartFiring()
 
 	} else {
 
-		// if we're full auto, schedule the next shot
+		// if we're full auto, schedule the next shot once the refire time is up
 		if (bFullAuto)
 		{
-			GetWorld()->GetTimerManager().SetTimer(RefireTimer, this, &AShooterWeapon::Fire, TimeSinceLastShot, false);
+			FixedStep->SetTimer(RefireTimer, FSimpleDelegate::CreateUObject(this, &AShooterWeapon::Fire), RefireRate - TimeSinceLastShot);
 		}
 
 	}
@@ -125,7 +140,10 @@ void AShooterWeapon::StopFiring()
 	bIsFiring = false;
 
 	// clear the refire timer
-	GetWorld()->GetTimerManager().ClearTimer(RefireTimer);
+	if (UShooterFixedStepSubsystem* FixedStep = GetFixedStep())
+	{
+		FixedStep->ClearTimer(RefireTimer);
+	}
 }
 
 void AShooterWeapon::Fire()
@@ -141,12 +159,19 @@ void AShooterWeapon::Fire()
 	{
 		return;
 	}
+
+	// shots are timed on the fixed step, so we can't fire without it
+	UShooterFixedStepSubsystem* FixedStep = GetFixedStep();
+	if (!FixedStep)
+	{
+		return;
+	}
 	
 	// fire a projectile at the target
 	FireProjectile(WeaponOwner->GetWeaponTargetLocation());
 
 	// update the time of our last shot
-	TimeOfLastShot = GetWorld()->GetTimeSeconds();
+	TimeOfLastShot = FixedStep->GetSimulationTime();
 
 	// make noise so the AI perception system can hear us
 	MakeNoise(ShotLoudness, PawnOwner, PawnOwner->GetActorLocation(), ShotNoiseRange, ShotNoiseTag);
@@ -155,11 +180,11 @@ void AShooterWeapon::Fire()
 	if (bFullAuto)
 	{
 		// schedule the next shot
-		GetWorld()->GetTimerManager().SetTimer(RefireTimer, this, &AShooterWeapon::Fire, RefireRate, false);
+		FixedStep->SetTimer(RefireTimer, FSimpleDelegate::CreateUObject(this, &AShooterWeapon::Fire), RefireRate);
 	} else {
 
 		// for semi-auto weapons, schedule the cooldown notification
-		GetWorld()->GetTimerManager().SetTimer(RefireTimer, this, &AShooterWeapon::FireCooldownExpired, RefireRate, false);
+		FixedStep->SetTimer(RefireTimer, FSimpleDelegate::CreateUObject(this, &AShooterWeapon::FireCooldownExpired), RefireRate);
 
 	}
 }
@@ -189,11 +214,31 @@ void AShooterWeapon::FireProjectile(const FVector& TargetLocation)
 	SpawnParams.Instigator = PawnOwner;
 
 	AShooterProjectile* Projectile = GetWorld()->SpawnActor<AShooterProjectile>(ProjectileClass, ProjectileTransform, SpawnParams);
+
+	// tag the projectile so kills can be credited to this weapon
+	if (Projectile)
+	{
+		Projectile->SetKillFeedWeaponId(KillFeedWeaponId);
+	}
 	
 	// consume bullets
 	SetCurrentBullets(CurrentBullets - 1);
 
-	MulticastFireProjectile();
+	// cosmetic only, the owner confirms its recoil from the replicated bullet count
+	if (UShooterGameplayCueSubsystem* Cues = GetWorld()->GetSubsystem<UShooterGameplayCueSubsystem>())
+	{
+		Cues->SendCue(EShooterCue::Fire, this);
+	}
+}
+
+uint32 AShooterWeapon::GetRecoilSeed() const
+{
+	return RecoilPatternSeed != 0 ? static_cast<uint32>(RecoilPatternSeed) : GetTypeHash(GetClass()->GetFName());
+}
+
+UShooterFixedStepSubsystem* AShooterWeapon::GetFixedStep() const
+{
+	return GetWorld()->GetSubsystem<UShooterFixedStepSubsystem>();
 }
 
 FTransform AShooterWeapon::CalculateProjectileSpawnTransform(const FVector& TargetLocation) const
@@ -245,36 +290,53 @@ bool AShooterWeapon::bIsFullAmmo() const
 
 void AShooterWeapon::SetCurrentBullets(int32 InCurrentBullets)
 {
+	const int32 OldBullets = CurrentBullets;
 	CurrentBullets = InCurrentBullets;
 
-	if (GetNetMode() == NM_ListenServer)
+	// local players on the server don't get the rep notify
+	if (GetNetMode() == NM_ListenServer || GetNetMode() == NM_Standalone)
 	{
-		OnRep_CurrentBullets();
+		OnRep_CurrentBullets(OldBullets);
 	}
 }
 
-void AShooterWeapon::MulticastFireProjectile_Implementation()
+void AShooterWeapon::PlayFireCue()
 {
+	if (!WeaponOwner)
+	{
+		return;
+	}
+
 	// play the firing montage
 	// (This should happen on ALL clients)
 	WeaponOwner->PlayFiringMontage(FiringMontage);
-   
-	if (AShooterCharacter* Char = Cast<AShooterCharacter>(WeaponOwner))
+
+	// firing keeps the owner fully significant
+	if (UShooterSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UShooterSignificanceSubsystem>())
 	{
-		// (This should happen only on the client who "controls" the character
-		if (Char->IsLocallyControlled())
-		{
-			// add recoil
-			WeaponOwner->AddWeaponRecoil(FiringRecoil);
-		}
+		Significance->ReportCombat(Cast<ACharacter>(GetOwner()));
 	}
 }
 
-void AShooterWeapon::OnRep_CurrentBullets() const
+void AShooterWeapon::OnRep_CurrentBullets(int32 OldBullets)
 {
-	if (WeaponOwner)
+	if (!WeaponOwner)
+	{
+		return;
+	}
+
+	// update the weapon HUD
+	WeaponOwner->UpdateWeaponHUD(CurrentBullets, MagazineSize);
+
+	// a lower count means the server fired. Several shots can arrive in one update
+	if (AShooterCharacter* Char = Cast<AShooterCharacter>(WeaponOwner))
 	{
-		// update the weapon HUD
-		WeaponOwner->UpdateWeaponHUD(CurrentBullets, MagazineSize);
+		if (Char->IsLocallyControlled())
+		{
+			for (int32 Shot = CurrentBullets; Shot < OldBullets; ++Shot)
+			{
+				WeaponOwner->AddWeaponRecoil(FiringRecoil);
+			}
+		}
 	}
 }
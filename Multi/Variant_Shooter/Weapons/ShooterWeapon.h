@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "ShooterWeaponHolder.h"
+#include "ShooterFixedStepSubsystem.h"
 #include "Animation/AnimInstance.h"
 #include "ShooterWeapon.generated.h"
 
@@ -50,8 +51,9 @@ protected:
 	UPROPERTY(ReplicatedUsing=OnRep_CurrentBullets)
 	int32 CurrentBullets = 0;
 
+	/** Updates the HUD and confirms the owner's predicted recoil for each shot fired */
 	UFUNCTION()
-	void OnRep_CurrentBullets() const;
+	void OnRep_CurrentBullets(int32 OldBullets);
 	
 	/** Animation montage to play when firing this weapon */
 	UPROPERTY(EditAnywhere, Category="Animation")
@@ -73,6 +75,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Aim", meta = (ClampMin = 0, ClampMax = 100))
 	float FiringRecoil = 0.0f;
 
+	/** Seed for the horizontal recoil pattern. 0 derives the seed from the weapon class */
+	UPROPERTY(EditAnywhere, Category="Aim")
+	int32 RecoilPatternSeed = 0;
+
 	/** Name of the first person muzzle socket where projectiles will spawn */
 	UPROPERTY(EditAnywhere, Category="Aim")
 	FName MuzzleSocketName;
@@ -81,6 +87,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Aim", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
 	float MuzzleOffset = 10.0f;
 
+	/** ID of this weapon shown in the kill feed */
+	UPROPERTY(EditAnywhere, Category="Kill Feed")
+	uint8 KillFeedWeaponId = 0;
+
 	/** If true, this weapon will automatically fire at the refire rate */
 	UPROPERTY(EditAnywhere, Category="Refire")
 	bool bFullAuto = false;
@@ -89,14 +99,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Refire", meta = (ClampMin = 0, ClampMax = 5, Units = "s"))
 	float RefireRate = 0.5f;
 
-	/** Game time of last shot fired, used to enforce refire rate on semi auto */
-	float TimeOfLastShot = 0.0f;
+	/** Simulation time of last shot fired, used to enforce refire rate on semi auto */
+	double TimeOfLastShot = 0.0;
 
 	/** If true, the weapon is currently firing */
 	bool bIsFiring = false;
 
-	/** Timer to handle full auto refiring */
-	FTimerHandle RefireTimer;
+	/** Fixed step timer to handle full auto refiring */
+	FShooterStepTimerHandle RefireTimer;
 
 	/** Cast pawn pointer to the owner for AI perception system interactions */
 	TObjectPtr<APawn> PawnOwner;
@@ -132,6 +142,9 @@ protected:
 	/** Fire a projectile towards the target location */
 	virtual void FireProjectile(const FVector& TargetLocation);
 
+	/** Returns the fixed step simulation driving refire */
+	UShooterFixedStepSubsystem* GetFixedStep() const;
+
 	/** Calculates the spawn transform for projectiles shot by this weapon */
 	FTransform CalculateProjectileSpawnTransform(const FVector& TargetLocation) const;
 	
@@ -174,8 +187,20 @@ public:
 	/** Returns the current bullet count */
 	int32 GetBulletCount() const { return CurrentBullets; }
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastFireProjectile();
+	/** Returns the recoil applied per shot */
+	float GetFiringRecoil() const { return FiringRecoil; }
+
+	/** Returns true if this weapon fires automatically while the trigger is held */
+	bool IsFullAuto() const { return bFullAuto; }
+
+	/** Returns the time between shots */
+	float GetRefireRate() const { return RefireRate; }
+
+	/** Returns the seed used for this weapon's recoil pattern */
+	uint32 GetRecoilSeed() const;
+
+	/** Plays the firing montage when the fire cue arrives */
+	void PlayFireCue();
 
 	/** Adds ammo pickup to current bullets */
 	void AddAmmo(int32 Amount);
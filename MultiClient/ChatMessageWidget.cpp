@@ -0,0 +1,29 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ChatMessageWidget.h"
+
+void UChatMessageWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	const UChatMessageItem* Item = Cast<UChatMessageItem>(ListItemObject);
+	if (!Item)
+	{
+		return;
+	}
+
+	if (Channel)
+	{
+		Channel->SetText(Item->Channel);
+		Channel->SetColorAndOpacity(Item->ChannelColor);
+	}
+
+	if (Sender)
+	{
+		Sender->SetText(Item->Sender);
+	}
+
+	if (Message)
+	{
+		Message->SetText(Item->Message);
+	}
+}
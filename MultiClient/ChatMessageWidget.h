@@ -0,0 +1,51 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
+#include "Components/TextBlock.h"
+#include "ChatMessageWidget.generated.h"
+
+/**
+ *  Data for one chat line. The chat list reuses these once it's full
+ */
+UCLASS()
+class MULTICLIENT_API UChatMessageItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	FText Channel;
+
+	FLinearColor ChannelColor = FLinearColor::White;
+
+	FText Sender;
+
+	FText Message;
+};
+
+/**
+ *  Entry widget for the chat list view. Entries are recycled as the list scrolls
+ */
+UCLASS()
+class MULTICLIENT_API UChatMessageWidget : public UUserWidget, public IUserObjectListEntry
+{
+	GENERATED_BODY()
+
+public:
+	/** Bind widgets */
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> Channel;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> Sender;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> Message;
+
+protected:
+	/** Fills the entry from a chat item */
+	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+};
@@ -0,0 +1,33 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+using UnrealBuildTool;
+
+/**
+ * Client only module with the HUD, widgets and touch controls.
+ * Listed as ClientOnly in the project so dedicated servers never build, link or load it.
+ */
+public class MultiClient : ModuleRules
+{
+	public MultiClient(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"InputCore",
+			"EnhancedInput",
+			"UMG",
+			"Slate",
+			"SlateCore",
+			"Multi"
+		});
+
+		PublicIncludePaths.AddRange(new string[] {
+			"MultiClient",
+			"MultiClient/Variant_Shooter/Audio",
+			"MultiClient/Variant_Shooter/UI"
+		});
+	}
+}
@@ -0,0 +1,8 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#include "MultiClient.h"
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, MultiClient);
+
+DEFINE_LOG_CATEGORY(LogMultiClient)
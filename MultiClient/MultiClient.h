@@ -0,0 +1,8 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Log category for the client only UI module */
+DECLARE_LOG_CATEGORY_EXTERN(LogMultiClient, Log, All);
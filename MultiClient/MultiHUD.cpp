@@ -0,0 +1,44 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "MultiHUD.h"
+#include "Blueprint/UserWidget.h"
+#include "GameFramework/PlayerController.h"
+#include "MultiClient.h"
+#include "Widgets/Input/SVirtualJoystick.h"
+
+void AMultiHUD::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// only spawn touch controls on local player controllers
+	APlayerController* PC = GetOwningPlayerController();
+	if (!PC || !PC->IsLocalPlayerController() || !SVirtualJoystick::ShouldDisplayTouchInterface())
+	{
+		return;
+	}
+
+	// spawn the mobile controls widget
+	MobileControlsWidget = CreateWidget<UUserWidget>(PC, MobileControlsWidgetClass);
+
+	if (MobileControlsWidget)
+	{
+		// add the controls to the player screen
+		MobileControlsWidget->AddToPlayerScreen(0);
+	}
+	else
+	{
+		UE_LOG(LogMultiClient, Error, TEXT("Could not spawn mobile controls widget."));
+	}
+}
+
+void AMultiHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (MobileControlsWidget)
+	{
+		MobileControlsWidget->RemoveFromParent();
+		MobileControlsWidget = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,35 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/HUD.h"
+#include "MultiHUD.generated.h"
+
+class UUserWidget;
+
+/**
+ *  Base HUD for the client module
+ *  Spawns the mobile touch controls, which used to live on the player controller
+ */
+UCLASS()
+class MULTICLIENT_API AMultiHUD : public AHUD
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Mobile controls widget to spawn */
+	UPROPERTY(EditAnywhere, Category="Input|Touch Controls")
+	TSubclassOf<UUserWidget> MobileControlsWidgetClass;
+
+	/** Pointer to the mobile controls widget */
+	UPROPERTY()
+	TObjectPtr<UUserWidget> MobileControlsWidget;
+
+	/** Spawns the touch controls */
+	virtual void BeginPlay() override;
+
+	/** Removes the touch controls */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
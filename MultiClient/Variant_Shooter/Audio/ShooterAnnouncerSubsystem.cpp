@@ -0,0 +1,148 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterAnnouncerSubsystem.h"
+#include "ShooterGameState.h"
+#include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+
+void UShooterAnnouncerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// load every announcer sound once, in the background
+	TArray<FSoftObjectPath> SoundPaths;
+	for (const TPair<int32, TSoftObjectPtr<USoundBase>>& StreakSound : StreakSounds)
+	{
+		if (!StreakSound.Value.IsNull())
+		{
+			SoundPaths.Add(StreakSound.Value.ToSoftObjectPath());
+		}
+	}
+
+	if (SoundPaths.Num() > 0)
+	{
+		SoundsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(SoundPaths);
+	}
+
+	WorldInitHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UShooterAnnouncerSubsystem::OnWorldInitializedActors);
+}
+
+void UShooterAnnouncerSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitHandle);
+
+	if (SoundsHandle.IsValid())
+	{
+		SoundsHandle->ReleaseHandle();
+		SoundsHandle.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+void UShooterAnnouncerSubsystem::OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params)
+{
+	UWorld* NewWorld = Params.World;
+	if (!NewWorld || NewWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	if (UWorld* OldWorld = World.Get())
+	{
+		OldWorld->GameStateSetEvent.Remove(GameStateSetHandle);
+	}
+
+	// audio components belong to the old world
+	World = NewWorld;
+	AudioPool.Reset();
+	LastStreaks.Reset();
+
+	// the game state may replicate after the world starts
+	if (NewWorld->GetGameState())
+	{
+		OnGameStateSet(NewWorld->GetGameState());
+	}
+	else
+	{
+		GameStateSetHandle = NewWorld->GameStateSetEvent.AddUObject(this, &UShooterAnnouncerSubsystem::OnGameStateSet);
+	}
+}
+
+void UShooterAnnouncerSubsystem::OnGameStateSet(AGameStateBase* GameState)
+{
+	if (AShooterGameState* ShooterGameState = Cast<AShooterGameState>(GameState))
+	{
+		ScoreboardHandle = ShooterGameState->OnScoreboardChanged.AddUObject(this, &UShooterAnnouncerSubsystem::OnScoreboardChanged);
+	}
+}
+
+void UShooterAnnouncerSubsystem::OnScoreboardChanged(const FShooterScoreboardEntry& Entry)
+{
+	const uint8* LastStreak = LastStreaks.Find(Entry.PlayerId);
+	const bool bStreakGrew = LastStreak && Entry.Streak > *LastStreak;
+
+	// rows seen for the first time are just history from joining late
+	LastStreaks.Add(Entry.PlayerId, Entry.Streak);
+
+	if (!bStreakGrew)
+	{
+		return;
+	}
+
+	if (const TSoftObjectPtr<USoundBase>* Sound = StreakSounds.Find(Entry.Streak))
+	{
+		// still loading, skip it rather than block
+		if (USoundBase* LoadedSound = Sound->Get())
+		{
+			PlayAnnouncement(LoadedSound);
+		}
+	}
+}
+
+void UShooterAnnouncerSubsystem::PlayAnnouncement(USoundBase* Sound)
+{
+	UAudioComponent* AudioComponent = nullptr;
+
+	// reuse an idle component
+	for (int32 Index = 0; Index < AudioPool.Num(); ++Index)
+	{
+		if (AudioPool[Index] && !AudioPool[Index]->IsPlaying())
+		{
+			AudioComponent = AudioPool[Index];
+			AudioPool.RemoveAt(Index);
+			break;
+		}
+	}
+
+	if (!AudioComponent)
+	{
+		if (AudioPool.Num() < MaxConcurrentAnnouncements)
+		{
+			AudioComponent = UGameplayStatics::CreateSound2D(World.Get(), Sound, 1.0f, 1.0f, 0.0f, nullptr, false, false);
+		}
+		else
+		{
+			// at the limit, the newest announcement wins
+			AudioComponent = AudioPool[0];
+			AudioPool.RemoveAt(0);
+			AudioComponent->Stop();
+		}
+	}
+
+	if (!AudioComponent)
+	{
+		return;
+	}
+
+	// newest last
+	AudioPool.Add(AudioComponent);
+
+	AudioComponent->SetSound(Sound);
+	AudioComponent->Play();
+}
@@ -0,0 +1,73 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ShooterAnnouncerSubsystem.generated.h"
+
+class AGameStateBase;
+class UAudioComponent;
+class USoundBase;
+struct FShooterScoreboardEntry;
+struct FStreamableHandle;
+
+/**
+ *  Plays the kill streak announcer on clients
+ *  Watches the streaks on the replicated scoreboard, so the server sends no sound RPCs and never loads the sounds
+ *  Sounds are soft references loaded asynchronously once per client, and played through a small pool of audio components
+ */
+UCLASS(Config=Game)
+class MULTICLIENT_API UShooterAnnouncerSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Starts loading the sounds and watching for new worlds */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Stops watching for new worlds */
+	virtual void Deinitialize() override;
+
+protected:
+
+	/** Sound to play by kill streak count */
+	UPROPERTY(Config, EditAnywhere, Category="Announcer")
+	TMap<int32, TSoftObjectPtr<USoundBase>> StreakSounds;
+
+	/** Max number of announcements playing at once. The oldest one is cut off when a new one starts */
+	UPROPERTY(Config, EditAnywhere, Category="Announcer", meta = (ClampMin = 1, ClampMax = 8))
+	int32 MaxConcurrentAnnouncements = 1;
+
+private:
+
+	/** Keeps the loaded sounds in memory */
+	TSharedPtr<FStreamableHandle> SoundsHandle;
+
+	/** Audio components reused for announcements, oldest first */
+	UPROPERTY()
+	TArray<TObjectPtr<UAudioComponent>> AudioPool;
+
+	/** Last streak seen by player ID */
+	TMap<int32, uint8> LastStreaks;
+
+	/** World the announcer is listening to */
+	TWeakObjectPtr<UWorld> World;
+
+	FDelegateHandle WorldInitHandle;
+	FDelegateHandle GameStateSetHandle;
+	FDelegateHandle ScoreboardHandle;
+
+	/** Binds to the new world's game state */
+	void OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params);
+
+	/** Binds to the game state's scoreboard */
+	void OnGameStateSet(AGameStateBase* GameState);
+
+	/** Plays the announcer when a player's streak reaches a new count */
+	void OnScoreboardChanged(const FShooterScoreboardEntry& Entry);
+
+	/** Plays a sound through the pool */
+	void PlayAnnouncement(USoundBase* Sound);
+};
@@ -0,0 +1,140 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "SShooterVitals.h"
+#include "ShooterVitalsSource.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+void SShooterVitals::Construct(const FArguments& InArgs)
+{
+	PlayerController = InArgs._PlayerController;
+	BarBrush = InArgs._BarBrush ? InArgs._BarBrush : FCoreStyle::Get().GetBrush("WhiteBrush");
+	Font = InArgs._Font;
+	BarSize = InArgs._BarSize;
+	BackgroundColor = InArgs._BackgroundColor;
+	LifeColor = InArgs._LifeColor;
+	DrainColor = InArgs._DrainColor;
+	AmmoColor = InArgs._AmmoColor;
+	LowAmmoColor = InArgs._LowAmmoColor;
+	LowAmmoFraction = InArgs._LowAmmoFraction;
+	DrainSpeed = InArgs._DrainSpeed;
+	AmmoPulseTime = InArgs._AmmoPulseTime;
+
+	if (FSlateApplication::IsInitialized())
+	{
+		TextHeight = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->GetMaxCharacterHeight(Font);
+	}
+}
+
+void SShooterVitals::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	APlayerController* PC = PlayerController.Get();
+	const IShooterVitalsSource* Source = PC ? Cast<IShooterVitalsSource>(PC->GetPawn()) : nullptr;
+
+	bool bChanged = false;
+
+	if (!Source)
+	{
+		bChanged = bHasVitals;
+		bHasVitals = false;
+		Bullets = INDEX_NONE;
+		MagazineSize = INDEX_NONE;
+	}
+	else
+	{
+		const FShooterVitals Vitals = Source->GetVitals();
+
+		// a new pawn starts without a trail
+		if (!bHasVitals)
+		{
+			DrainedLife = Vitals.LifePercent;
+		}
+
+		bChanged |= !bHasVitals || Vitals.LifePercent != Life;
+		bHasVitals = true;
+		Life = Vitals.LifePercent;
+
+		// the trail only shows lost life, healing moves it right away
+		if (DrainedLife > Life)
+		{
+			DrainedLife = FMath::Max(Life, DrainedLife - DrainSpeed * InDeltaTime);
+			bChanged = true;
+		}
+		else
+		{
+			DrainedLife = Life;
+		}
+
+		if (Vitals.Bullets != Bullets || Vitals.MagazineSize != MagazineSize)
+		{
+			// flash on every shot
+			if (Vitals.MagazineSize == MagazineSize && Vitals.Bullets < Bullets)
+			{
+				AmmoPulse = AmmoPulseTime;
+			}
+
+			Bullets = Vitals.Bullets;
+			MagazineSize = Vitals.MagazineSize;
+			AmmoText = MagazineSize > 0 ? FString::Printf(TEXT("%d / %d"), Bullets, MagazineSize) : FString();
+			bChanged = true;
+		}
+	}
+
+	if (AmmoPulse > 0.0f)
+	{
+		AmmoPulse = FMath::Max(0.0f, AmmoPulse - InDeltaTime);
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+int32 SShooterVitals::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	if (!bHasVitals)
+	{
+		return LayerId;
+	}
+
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
+
+	// bar background, lost life trail and life, back to front
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(BarSize, FSlateLayoutTransform()), BarBrush, ESlateDrawEffect::None, BackgroundColor * Tint);
+
+	if (DrainedLife > Life)
+	{
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(FVector2D(BarSize.X * DrainedLife, BarSize.Y), FSlateLayoutTransform()), BarBrush, ESlateDrawEffect::None, DrainColor * Tint);
+	}
+
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(FVector2D(BarSize.X * Life, BarSize.Y), FSlateLayoutTransform()), BarBrush, ESlateDrawEffect::None, LifeColor * Tint);
+
+	if (!AmmoText.IsEmpty())
+	{
+		const bool bLowAmmo = Bullets <= FMath::FloorToInt(MagazineSize * LowAmmoFraction);
+		FLinearColor TextColor = bLowAmmo ? LowAmmoColor : AmmoColor;
+
+		// fade from white back to the counter color after a shot
+		if (AmmoPulseTime > 0.0f)
+		{
+			TextColor = FLinearColor::LerpUsingHSV(TextColor, FLinearColor::White, AmmoPulse / AmmoPulseTime);
+		}
+
+		const FVector2D TextOffset(0.0f, BarSize.Y);
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId + 3, AllottedGeometry.ToPaintGeometry(FVector2D(BarSize.X, TextHeight), FSlateLayoutTransform(TextOffset)), AmmoText, Font, ESlateDrawEffect::None, TextColor * Tint);
+	}
+
+	return LayerId + 3;
+}
+
+FVector2D SShooterVitals::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D(BarSize.X, BarSize.Y + TextHeight);
+}
@@ -0,0 +1,112 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "Fonts/SlateFontInfo.h"
+
+class APlayerController;
+struct FSlateBrush;
+
+/**
+ *  Native ammo counter and health bar
+ *  Polls the local pawn through IShooterVitalsSource every frame and animates on its own,
+ *  so firing and taking damage never run Blueprint code on the HUD path
+ *  Only repaints while a value or an animation is changing
+ */
+class MULTICLIENT_API SShooterVitals : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SShooterVitals)
+		: _BarBrush(nullptr)
+		, _BarSize(FVector2D(300.0f, 16.0f))
+		, _BackgroundColor(FLinearColor(0.0f, 0.0f, 0.0f, 0.5f))
+		, _LifeColor(FLinearColor::Green)
+		, _DrainColor(FLinearColor::Red)
+		, _AmmoColor(FLinearColor::White)
+		, _LowAmmoColor(FLinearColor::Red)
+		, _LowAmmoFraction(0.25f)
+		, _DrainSpeed(0.5f)
+		, _AmmoPulseTime(0.15f)
+		{}
+
+		/** Player whose pawn is shown */
+		SLATE_ARGUMENT(TWeakObjectPtr<APlayerController>, PlayerController)
+
+		/** Brush for the bar background and fill */
+		SLATE_ARGUMENT(const FSlateBrush*, BarBrush)
+
+		/** Font for the ammo counter */
+		SLATE_ARGUMENT(FSlateFontInfo, Font)
+
+		/** Size of the health bar */
+		SLATE_ARGUMENT(FVector2D, BarSize)
+
+		SLATE_ARGUMENT(FLinearColor, BackgroundColor)
+		SLATE_ARGUMENT(FLinearColor, LifeColor)
+
+		/** Color of the trail left behind by lost life */
+		SLATE_ARGUMENT(FLinearColor, DrainColor)
+
+		SLATE_ARGUMENT(FLinearColor, AmmoColor)
+		SLATE_ARGUMENT(FLinearColor, LowAmmoColor)
+
+		/** The ammo counter turns the low ammo color at or below this fraction of the magazine */
+		SLATE_ARGUMENT(float, LowAmmoFraction)
+
+		/** Speed the lost life trail catches up, in life fraction per second */
+		SLATE_ARGUMENT(float, DrainSpeed)
+
+		/** Time the ammo counter flashes after a shot */
+		SLATE_ARGUMENT(float, AmmoPulseTime)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	//~Begin SWidget interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	//~End SWidget interface
+
+private:
+
+	TWeakObjectPtr<APlayerController> PlayerController;
+
+	const FSlateBrush* BarBrush = nullptr;
+	FSlateFontInfo Font;
+	FVector2D BarSize;
+	FLinearColor BackgroundColor;
+	FLinearColor LifeColor;
+	FLinearColor DrainColor;
+	FLinearColor AmmoColor;
+	FLinearColor LowAmmoColor;
+	float LowAmmoFraction = 0.25f;
+	float DrainSpeed = 0.5f;
+	float AmmoPulseTime = 0.15f;
+
+	/** Height of the ammo counter line */
+	float TextHeight = 0.0f;
+
+	/** True while the pawn has vitals to show */
+	bool bHasVitals = false;
+
+	/** Life shown by the bar */
+	float Life = 0.0f;
+
+	/** End of the lost life trail, catching up to the life */
+	float DrainedLife = 0.0f;
+
+	/** Ammo values shown by the counter */
+	int32 Bullets = INDEX_NONE;
+	int32 MagazineSize = INDEX_NONE;
+
+	/** Counter text, rebuilt only when the ammo changes */
+	FString AmmoText;
+
+	/** Time left on the ammo flash */
+	float AmmoPulse = 0.0f;
+};
@@ -4,71 +4,61 @@
 #include "ShooterBulletCounterUI.h"
 
 #include "ChatMessageWidget.h"
+#include "ShooterHUDViewModel.h"
 #include "ShooterBPLibrary.h"
 #include "ShooterCharacter.h"
-#include "ShooterGameState.h"
 #include "ShooterPlayerController.h"
 #include "ShooterPlayerState.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
+#include "Blueprint/WidgetTree.h"
 #include "Components/CheckBox.h"
-#include "GameFramework/GameMode.h"
+#include "Components/InvalidationBox.h"
 #include "GameFramework/PlayerState.h"
 
-void UShooterBulletCounterUI::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UShooterBulletCounterUI::OnTeamScoresChanged(int32 RedTeamScore, int32 BlueTeamScore)
 {
-	Super::NativeTick(MyGeometry, InDeltaTime);
+	if (RedScore)
+	{
+		RedScore->SetText(FText::AsNumber(RedTeamScore));
+	}
 
-	// Get the GameState
-	AShooterGameState* GameState = UShooterBPLibrary::GetShooterGameState(this);
-	
-	// Update team score
-	if (GameState)
+	if (BlueScore)
 	{
-		if (RedScore)
-		{
-			RedScore->SetText(FText::AsNumber(GameState->RedTeamScore));
-		}
-        
-		if (BlueScore)
-		{
-			BlueScore->SetText(FText::AsNumber(GameState->BlueTeamScore));
-		}
+		BlueScore->SetText(FText::AsNumber(BlueTeamScore));
 	}
-    
-	// Update player score
-	if (AShooterPlayerController* PlayerController = UShooterBPLibrary::GetShooterController(this))
+}
+
+void UShooterBulletCounterUI::OnPlayerScoreChanged(int32 Score)
+{
+	if (MyScore)
 	{
-		if (APlayerState* PlayerState = PlayerController->GetPlayerState<APlayerState>())
-		{
-			if (MyScore)
-			{
-				MyScore->SetText(FText::AsNumber(PlayerState->GetScore()));
-			}
-		}
+		MyScore->SetText(FText::AsNumber(Score));
 	}
+}
+
+void UShooterBulletCounterUI::OnWaitingToStartChanged(bool bWaitingToStart)
+{
+	// Show the timer and ready check box only while waiting to start
+	SetShown(Timer, bWaitingToStart);
 
-	// If we aren't in progress, show the timer
-	if (GameState && GameState->GetMatchState() == MatchState::WaitingToStart)
+	if (ReadyCheckBox)
 	{
-		// If we can't see the timer, make it visible
-		if (Timer->GetVisibility() != ESlateVisibility::HitTestInvisible)
+		// Clear it when it shows up again after a match reset
+		if (bWaitingToStart && ReadyCheckBox->GetVisibility() != ESlateVisibility::Visible)
 		{
-			Timer->SetVisibility(ESlateVisibility::HitTestInvisible);
+			ReadyCheckBox->SetIsChecked(false);
 		}
-		
-		FString TimerText = FString::Printf(TEXT("%f"), GameState->WaitingToStartTime);
-		Timer->SetText(FText::FromString(TimerText));
 
-		// If WaitingToStart, ReadyCheckBox is Visible
-		ReadyCheckBox->SetVisibility(ESlateVisibility::Visible);
+		SetShown(ReadyCheckBox, bWaitingToStart, ESlateVisibility::Visible);
 	}
-	else if (Timer->GetVisibility() != ESlateVisibility::Hidden)
+}
+
+void UShooterBulletCounterUI::OnCountdownChanged(int32 SecondsLeft)
+{
+	if (Timer)
 	{
-		// Hide this because match is in progress
-		Timer->SetVisibility(ESlateVisibility::Hidden);
-		ReadyCheckBox->SetVisibility(ESlateVisibility::Hidden);
+		Timer->SetText(FText::AsNumber(SecondsLeft));
 	}
-
 }
 
 void UShooterBulletCounterUI::ShowAlert(const FString& AlertMessage, FLinearColor Color, float Duration)
@@ -77,7 +67,7 @@ void UShooterBulletCounterUI::ShowAlert(const FString& AlertMessage, FLinearColo
 	{
 		AlertText->SetText(FText::FromString(AlertMessage));
 		AlertText->SetColorAndOpacity(Color);
-		AlertText->SetVisibility(ESlateVisibility::Visible);
+		SetShown(AlertText, true);
 
 		GetWorld()->GetTimerManager().SetTimer(AlertTimerHandle, this, &UShooterBulletCounterUI::HideAlert, Duration, false);
 	}
@@ -87,7 +77,7 @@ void UShooterBulletCounterUI::HideAlert()
 {
 	if (AlertText)
 	{
-		AlertText->SetVisibility(ESlateVisibility::Hidden);
+		SetShown(AlertText, false);
 	}
 }
 
@@ -97,14 +87,14 @@ void UShooterBulletCounterUI::ShowDeathScreen(float RespawnTime)
 	if (DeathMessage)
 	{
 		DeathMessage->SetText(FText::FromString("You are dead:("));
-		DeathMessage->SetVisibility(ESlateVisibility::Visible);
+		SetShown(DeathMessage, true);
 	}
 
 	// Respawn timer
 	if (RespawnTimer)
 	{
 		TimeUntilRespawn = RespawnTime;
-		RespawnTimer->SetVisibility(ESlateVisibility::Visible);
+		SetShown(RespawnTimer, true);
 
 		UpdateRespawnCountdown();
 
@@ -117,12 +107,12 @@ void UShooterBulletCounterUI::HideDeathScreen()
 	// Hide death screen
 	if (DeathMessage)
 	{
-		DeathMessage->SetVisibility(ESlateVisibility::Hidden);
+		SetShown(DeathMessage, false);
 	}
 
 	if (RespawnTimer)
 	{
-		RespawnTimer->SetVisibility(ESlateVisibility::Hidden);
+		SetShown(RespawnTimer, false);
 	}
 
 	GetWorld()->GetTimerManager().ClearTimer(RespawnCountdownHandle);
@@ -130,62 +120,49 @@ void UShooterBulletCounterUI::HideDeathScreen()
 
 void UShooterBulletCounterUI::AddChatMessage(EShooterTeam Team, const FString& SenderName, const FString& Message)
 {
-	// Create a new chat message widget instance
-	UChatMessageWidget* NewMessageWidget = CreateWidget<UChatMessageWidget>(this, ChatMessageWidgetClass);
-
-	// Check NewMessageWidget
-	if (!NewMessageWidget)
+	if (!ChatList)
 	{
 		return;
 	}
 
-	// Add to ChatMessages vertical box
-	if (ChatMessages)
+	// Drop the oldest line once the chat is full, so memory stays flat however long the match runs.
+	// Lines are never reused, since the list keeps showing a visible row's old text if its item is mutated
+	if (ChatItems.Num() >= MaxChatMessages)
 	{
-		ChatMessages->AddChildToVerticalBox(NewMessageWidget);
+		ChatList->RemoveItem(ChatItems[0]);
+		ChatItems.RemoveAt(0);
 	}
 
-	// Set the sender name
-	if (NewMessageWidget->Sender)
-	{
-		NewMessageWidget->Sender->SetText(FText::FromString(SenderName));
-	}
+	UChatMessageItem* Item = NewObject<UChatMessageItem>(this);
+	ChatItems.Add(Item);
 
-	// Set the message content
-	if (NewMessageWidget->Message)
-	{
-		NewMessageWidget->Message->SetText(FText::FromString(Message));
-	}
+	Item->Sender = FText::FromString(SenderName);
+	Item->Message = FText::FromString(Message);
 
 	// Set channel text and color
-	if (NewMessageWidget->Channel)
+	if (Team == EShooterTeam::None) // All chat
 	{
-		if (Team == EShooterTeam::None) // All chat
-		{
-			NewMessageWidget->Channel->SetText(FText::FromString("[All]"));
-			NewMessageWidget->Channel->SetColorAndOpacity(FLinearColor::White);
-		}
-		else // Team chat
-		{
-			NewMessageWidget->Channel->SetText(FText::FromString("[Team]"));
+		Item->Channel = FText::FromString("[All]");
+		Item->ChannelColor = FLinearColor::White;
+	}
+	else // Team chat
+	{
+		Item->Channel = FText::FromString("[Team]");
+		Item->ChannelColor = FLinearColor::White;
 
-			// Get local player's team for color
-			if (AShooterPlayerController* PC = UShooterBPLibrary::GetShooterController(this))
+		// Get local player's team for color
+		if (AShooterPlayerController* PC = UShooterBPLibrary::GetShooterController(this))
+		{
+			if (AShooterCharacter* LocalCharacter = PC->GetPawn<AShooterCharacter>())
 			{
-				if (AShooterCharacter* LocalCharacter = PC->GetPawn<AShooterCharacter>())
-				{
-					FLinearColor TeamColor = (LocalCharacter->Team == EShooterTeam::Red) ? FLinearColor::Red : FLinearColor::Blue;
-					NewMessageWidget->Channel->SetColorAndOpacity(TeamColor);
-				}
+				Item->ChannelColor = (LocalCharacter->Team == EShooterTeam::Red) ? FLinearColor::Red : FLinearColor::Blue;
 			}
 		}
 	}
 
-	// Scroll to end
-	if (ChatScrollBox)
-	{
-		ChatScrollBox->ScrollToEnd();
-	}
+	// Only the visible rows have entry widgets, and they're recycled as the list scrolls
+	ChatList->AddItem(Item);
+	ChatList->ScrollToBottom();
 }
 
 void UShooterBulletCounterUI::StartChatInput(bool bIsTeamChat)
@@ -193,7 +170,7 @@ void UShooterBulletCounterUI::StartChatInput(bool bIsTeamChat)
 	if (ChatTextBox && ChatTeam && ChatEntry)
 	{
 		// Show ChatEntry
-		ChatEntry->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+		SetShown(ChatEntry, true, ESlateVisibility::SelfHitTestInvisible);
 		
 		// Set the chat type text
 		if (bIsTeamChat)
@@ -240,9 +217,43 @@ void UShooterBulletCounterUI::UpdateRespawnCountdown()
 	}
 }
 
+void UShooterBulletCounterUI::SetShown(UWidget* Widget, bool bShown, ESlateVisibility ShownVisibility)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	// hidden widgets keep their place in the layout, but skip paint, input and focus
+	const ESlateVisibility Visibility = bShown ? ShownVisibility : ESlateVisibility::Hidden;
+	if (Widget->GetVisibility() != Visibility)
+	{
+		Widget->SetVisibility(Visibility);
+	}
+}
+
+void UShooterBulletCounterUI::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	// Cache the whole HUD. Score, countdown and visibility changes then only invalidate the widget that changed
+	if (!StaticChrome && WidgetTree && WidgetTree->RootWidget)
+	{
+		StaticChrome = WidgetTree->ConstructWidget<UInvalidationBox>(UInvalidationBox::StaticClass(), TEXT("StaticChrome"));
+		StaticChrome->SetContent(WidgetTree->RootWidget);
+		WidgetTree->RootWidget = StaticChrome;
+	}
+}
+
 void UShooterBulletCounterUI::NativeConstruct()
 {
 	Super::NativeConstruct();
+
+	// Start with the transient elements hidden, without taking them out of the layout
+	SetShown(AlertText, false);
+	SetShown(DeathMessage, false);
+	SetShown(RespawnTimer, false);
+	SetShown(ChatEntry, false);
     
 	// Bind to the ChatTextBox OnTextCommitted delegate
 	if (ChatTextBox)
@@ -255,6 +266,18 @@ void UShooterBulletCounterUI::NativeConstruct()
 	{
 		ReadyCheckBox->OnCheckStateChanged.AddDynamic(this, &UShooterBulletCounterUI::OnReadyCheckStateChanged);
 	}
+
+	// Let the view model push HUD values as they change
+	if (!ViewModel)
+	{
+		ViewModel = NewObject<UShooterHUDViewModel>(this);
+		ViewModel->OnTeamScoresChanged.AddUObject(this, &UShooterBulletCounterUI::OnTeamScoresChanged);
+		ViewModel->OnPlayerScoreChanged.AddUObject(this, &UShooterBulletCounterUI::OnPlayerScoreChanged);
+		ViewModel->OnWaitingToStartChanged.AddUObject(this, &UShooterBulletCounterUI::OnWaitingToStartChanged);
+		ViewModel->OnCountdownChanged.AddUObject(this, &UShooterBulletCounterUI::OnCountdownChanged);
+	}
+
+	ViewModel->Initialize(GetOwningPlayer());
 }
 
 void UShooterBulletCounterUI::NativeDestruct()
@@ -269,6 +292,11 @@ void UShooterBulletCounterUI::NativeDestruct()
 	{
 		ReadyCheckBox->OnCheckStateChanged.RemoveDynamic(this, &UShooterBulletCounterUI::OnReadyCheckStateChanged);
 	}
+
+	if (ViewModel)
+	{
+		ViewModel->Deinitialize();
+	}
     
 	Super::NativeDestruct();
 }
@@ -295,11 +323,8 @@ void UShooterBulletCounterUI::OnChatTextCommitted(const FText& Text, ETextCommit
                 	// Get the player state
                     if (AShooterPlayerState* PS = PC->GetPlayerState<AShooterPlayerState>())
                     {
-                        EShooterTeam TeamToSend = bIsTeamChat ? PS->Team : EShooterTeam::None;
-                        
-                        // Get sender name
-                        FString SenderName = PS->GetPlayerName();
-                        PS->ServerSendChatMessage(TeamToSend, SenderName, MessageText);
+                        // The server fills in the sender and team
+                        PS->ServerSendChatMessage(bIsTeamChat, MessageText);
                     }
                 }
             }
@@ -313,7 +338,7 @@ void UShooterBulletCounterUI::OnChatTextCommitted(const FText& Text, ETextCommit
         	// Hide ChatEntry
         	if (ChatEntry)
         	{
-        		ChatEntry->SetVisibility(ESlateVisibility::Hidden);
+        		SetShown(ChatEntry, false);
         	}
             
             // Set input mode back to game only
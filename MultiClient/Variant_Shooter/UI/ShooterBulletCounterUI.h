@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "ShooterPlayerState.h"
+#include "Components/EditableTextBox.h"
+#include "Components/HorizontalBox.h"
+#include "Components/ListView.h"
+#include "Components/TextBlock.h"
+#include "Components/VerticalBox.h"
+#include "ShooterBulletCounterUI.generated.h"
+
+/**
+ *  Simple bullet counter UI widget for a first person shooter game
+ *  Scores and the match countdown are pushed by a HUD view model, so the widget never ticks
+ *  The HUD is cached in an invalidation box, so only the widgets that change are laid out and painted again
+ *  Elements that come and go are Hidden rather than Collapsed, so they keep their space and toggling them never relayouts the rest of the HUD
+ */
+UCLASS(abstract, meta = (DisableNativeTick))
+class MULTICLIENT_API UShooterBulletCounterUI : public UUserWidget
+{
+	GENERATED_BODY()
+	
+public:
+
+	/** Allows Blueprint to update sub-widgets with the new bullet count */
+	UFUNCTION(BlueprintImplementableEvent, Category="Shooter", meta=(DisplayName = "UpdateBulletCounter"))
+	void BP_UpdateBulletCounter(int32 MagazineSize, int32 BulletCount);
+
+	/** Allows Blueprint to update sub-widgets with the new life total and play a damage effect on the HUD */
+	UFUNCTION(BlueprintImplementableEvent, Category="Shooter", meta=(DisplayName = "Damaged"))
+	void BP_Damaged(float LifePercent);
+
+	/** Allows Blueprint to show a hit marker and damage number for the hits the player landed in one server frame */
+	UFUNCTION(BlueprintImplementableEvent, Category="Shooter", meta=(DisplayName = "Hit Confirmed"))
+	void BP_HitConfirmed(int32 Hits, int32 Headshots, int32 Kills, int32 Damage, FVector Location);
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> RedScore;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> BlueScore;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> MyScore;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> Timer;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> AlertText;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> DeathMessage;
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> RespawnTimer;
+
+	/** Invalidation box the HUD is cached in. Wrapped around the whole widget tree unless the widget Blueprint provides one */
+	UPROPERTY(meta=(BindWidgetOptional))
+	TObjectPtr<class UInvalidationBox> StaticChrome;
+
+	/** Optional native ammo counter and health bar. When bound, the UpdateBulletCounter and Damaged events aren't called */
+	UPROPERTY(meta=(BindWidgetOptional))
+	TObjectPtr<class UShooterVitalsWidget> Vitals;
+
+	/** Chat Bind Widgets */
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UVerticalBox> ChatBox;
+
+	/** Virtualized chat list. Its entry widget class should be a UChatMessageWidget */
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UListView> ChatList;
+	
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UHorizontalBox> ChatEntry;
+	
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UTextBlock> ChatTeam;
+	
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<UEditableTextBox> ChatTextBox;
+	
+	UFUNCTION()
+	void ShowAlert(const FString& AlertMessage, FLinearColor Color, float Duration);
+
+	UFUNCTION()
+	void HideAlert();
+
+	UFUNCTION()
+	void ShowDeathScreen(float RespawnTime);
+
+	UFUNCTION()
+	void HideDeathScreen();
+
+	UFUNCTION()
+	void AddChatMessage(EShooterTeam Team, const FString& SenderName, const FString& Message);
+
+	/** Number of chat lines kept. The oldest line is dropped for each new message once full */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ClampMin = 1))
+	int32 MaxChatMessages = 50;
+
+	UFUNCTION()
+	void StartChatInput(bool bIsTeamChat);
+
+	UPROPERTY(meta=(BindWidget))
+	TObjectPtr<class UCheckBox> ReadyCheckBox;
+
+private:
+	FTimerHandle AlertTimerHandle;
+
+	FTimerHandle RespawnCountdownHandle;
+
+	float TimeUntilRespawn;
+
+	/** Chat lines, oldest first */
+	UPROPERTY()
+	TArray<TObjectPtr<class UChatMessageItem>> ChatItems;
+
+	/** Shows or hides a widget without changing its layout. Hidden widgets aren't painted and never take input or focus */
+	static void SetShown(UWidget* Widget, bool bShown, ESlateVisibility ShownVisibility = ESlateVisibility::HitTestInvisible);
+
+	/** Values shown on the HUD */
+	UPROPERTY()
+	TObjectPtr<class UShooterHUDViewModel> ViewModel;
+
+	/** Updates the team scores */
+	void OnTeamScoresChanged(int32 RedTeamScore, int32 BlueTeamScore);
+
+	/** Updates the player score */
+	void OnPlayerScoreChanged(int32 Score);
+
+	/** Shows the countdown and ready check box while waiting to start */
+	void OnWaitingToStartChanged(bool bWaitingToStart);
+
+	/** Updates the countdown */
+	void OnCountdownChanged(int32 SecondsLeft);
+    
+	UFUNCTION()
+	void UpdateRespawnCountdown();
+
+protected:
+
+	/** Wraps the widget tree in the invalidation box before the Slate widgets are built */
+	virtual void NativeOnInitialized() override;
+
+	virtual void NativeConstruct() override;
+
+	virtual void NativeDestruct() override;
+
+	UFUNCTION()
+	void OnChatTextCommitted(const FText& Text, ETextCommit::Type CommitMethod);
+
+	UFUNCTION()
+	void OnReadyCheckStateChanged(bool bIsChecked);
+};
@@ -0,0 +1,105 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterHUD.h"
+#include "ShooterBulletCounterUI.h"
+#include "ShooterVitalsWidget.h"
+#include "GameFramework/PlayerController.h"
+#include "MultiClient.h"
+
+void AShooterHUD::BeginPlay()
+{
+	Super::BeginPlay();
+
+	APlayerController* PC = GetOwningPlayerController();
+	if (!PC)
+	{
+		return;
+	}
+
+	// create the bullet counter widget and add it to the screen
+	BulletCounterUI = CreateWidget<UShooterBulletCounterUI>(PC, BulletCounterUIClass);
+
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->AddToPlayerScreen(0);
+
+		// the ready check needs the mouse until the match starts
+		FInputModeUIOnly InputMode;
+		PC->SetInputMode(InputMode);
+		PC->SetShowMouseCursor(true);
+	}
+	else
+	{
+		UE_LOG(LogMultiClient, Error, TEXT("Could not spawn bullet counter widget."));
+	}
+}
+
+void AShooterHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// the widget goes away with the world, a new HUD creates its own after seamless travel
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->RemoveFromParent();
+		BulletCounterUI = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AShooterHUD::UpdateBulletCounter(int32 MagazineSize, int32 Bullets)
+{
+	// the native vitals widget reads the ammo on its own
+	if (BulletCounterUI && !BulletCounterUI->Vitals)
+	{
+		BulletCounterUI->BP_UpdateBulletCounter(MagazineSize, Bullets);
+	}
+}
+
+void AShooterHUD::ShowDamage(float LifePercent)
+{
+	if (BulletCounterUI && !BulletCounterUI->Vitals)
+	{
+		BulletCounterUI->BP_Damaged(LifePercent);
+	}
+}
+
+void AShooterHUD::ShowAlert(const FString& Text, FLinearColor Color, float Duration)
+{
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->ShowAlert(Text, Color, Duration);
+	}
+}
+
+void AShooterHUD::ShowHitFeedback(const FShooterHitFeedback& Feedback)
+{
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->BP_HitConfirmed(Feedback.Hits, Feedback.Headshots, Feedback.Kills, Feedback.Damage, Feedback.Location);
+	}
+}
+
+void AShooterHUD::ShowDeathScreen(float RespawnTime)
+{
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->ShowDeathScreen(RespawnTime);
+	}
+}
+
+void AShooterHUD::AddChatMessage(EShooterTeam Team, const FString& SenderName, const FString& Message)
+{
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->AddChatMessage(Team, SenderName, Message);
+	}
+}
+
+void AShooterHUD::StartChatInput(bool bTeamOnly)
+{
+	if (BulletCounterUI)
+	{
+		BulletCounterUI->StartChatInput(bTeamOnly);
+	}
+}
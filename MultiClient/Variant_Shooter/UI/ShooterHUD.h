@@ -0,0 +1,48 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiHUD.h"
+#include "ShooterHUDListener.h"
+#include "ShooterHUD.generated.h"
+
+class UShooterBulletCounterUI;
+
+/**
+ *  HUD for the shooter game. Only exists on clients
+ *  Owns the bullet counter widget and forwards gameplay events to it
+ */
+UCLASS()
+class MULTICLIENT_API AShooterHUD : public AMultiHUD, public IShooterHUDListener
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Type of bullet counter UI widget to spawn */
+	UPROPERTY(EditAnywhere, Category="Shooter|UI")
+	TSubclassOf<UShooterBulletCounterUI> BulletCounterUIClass;
+
+	/** Bullet counter UI widget */
+	UPROPERTY()
+	TObjectPtr<UShooterBulletCounterUI> BulletCounterUI;
+
+	/** Creates the widgets */
+	virtual void BeginPlay() override;
+
+	/** Removes the widgets */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	//~Begin IShooterHUDListener interface
+	virtual void UpdateBulletCounter(int32 MagazineSize, int32 Bullets) override;
+	virtual void ShowDamage(float LifePercent) override;
+	virtual void ShowAlert(const FString& Text, FLinearColor Color, float Duration) override;
+	virtual void ShowHitFeedback(const FShooterHitFeedback& Feedback) override;
+	virtual void ShowDeathScreen(float RespawnTime) override;
+	virtual void AddChatMessage(EShooterTeam Team, const FString& SenderName, const FString& Message) override;
+	virtual void StartChatInput(bool bTeamOnly) override;
+	//~End IShooterHUDListener interface
+};
@@ -0,0 +1,196 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterHUDViewModel.h"
+#include "ShooterGameState.h"
+#include "ShooterPlayerState.h"
+#include "ShooterArena.h"
+#include "ShooterArenaSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/GameMode.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+void UShooterHUDViewModel::Initialize(APlayerController* InPlayerController)
+{
+	Deinitialize();
+
+	PlayerController = InPlayerController;
+	bHasValues = false;
+	Countdown = INDEX_NONE;
+
+	TryBind();
+}
+
+void UShooterHUDViewModel::Deinitialize()
+{
+	if (AShooterGameState* BoundGameState = GameState.Get())
+	{
+		BoundGameState->OnHUDStateChanged.Remove(GameStateHandle);
+	}
+
+	if (AShooterPlayerState* BoundPlayerState = PlayerState.Get())
+	{
+		BoundPlayerState->OnHUDStateChanged.Remove(PlayerStateHandle);
+	}
+
+	if (AShooterArena* BoundArena = Arena.Get())
+	{
+		BoundArena->OnTeamScoresChanged.Remove(ArenaHandle);
+	}
+
+	if (UWorld* World = GetPlayerWorld())
+	{
+		World->GetTimerManager().ClearTimer(BindRetryTimer);
+		World->GetTimerManager().ClearTimer(CountdownTimer);
+	}
+
+	GameState.Reset();
+	PlayerState.Reset();
+	Arena.Reset();
+}
+
+void UShooterHUDViewModel::TryBind()
+{
+	UWorld* World = GetPlayerWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (!GameState.IsValid())
+	{
+		if (AShooterGameState* NewGameState = World->GetGameState<AShooterGameState>())
+		{
+			GameState = NewGameState;
+			GameStateHandle = NewGameState->OnHUDStateChanged.AddUObject(this, &UShooterHUDViewModel::Refresh);
+		}
+	}
+
+	if (!PlayerState.IsValid())
+	{
+		if (AShooterPlayerState* NewPlayerState = PlayerController->GetPlayerState<AShooterPlayerState>())
+		{
+			PlayerState = NewPlayerState;
+			PlayerStateHandle = NewPlayerState->OnHUDStateChanged.AddUObject(this, &UShooterHUDViewModel::Refresh);
+		}
+	}
+
+	Refresh();
+
+	// keep trying until both have replicated
+	if (!GameState.IsValid() || !PlayerState.IsValid())
+	{
+		World->GetTimerManager().SetTimer(BindRetryTimer, FTimerDelegate::CreateUObject(this, &UShooterHUDViewModel::TryBind), BindRetryInterval, false);
+	}
+}
+
+void UShooterHUDViewModel::BindArena()
+{
+	AShooterArena* NewArena = nullptr;
+
+	if (PlayerState.IsValid() && PlayerState->ArenaIndex != INDEX_NONE)
+	{
+		if (UShooterArenaSubsystem* Arenas = GetPlayerWorld()->GetSubsystem<UShooterArenaSubsystem>())
+		{
+			NewArena = Arenas->GetArena(PlayerState->ArenaIndex);
+		}
+	}
+
+	if (NewArena == Arena.Get())
+	{
+		return;
+	}
+
+	if (AShooterArena* OldArena = Arena.Get())
+	{
+		OldArena->OnTeamScoresChanged.Remove(ArenaHandle);
+	}
+
+	Arena = NewArena;
+
+	if (NewArena)
+	{
+		ArenaHandle = NewArena->OnTeamScoresChanged.AddUObject(this, &UShooterHUDViewModel::Refresh);
+	}
+}
+
+void UShooterHUDViewModel::Refresh()
+{
+	BindArena();
+
+	// team scores, from our arena if the level hosts several
+	int32 NewRedScore = 0;
+	int32 NewBlueScore = 0;
+
+	if (const AShooterArena* BoundArena = Arena.Get())
+	{
+		NewRedScore = BoundArena->RedTeamScore;
+		NewBlueScore = BoundArena->BlueTeamScore;
+	}
+	else if (const AShooterGameState* BoundGameState = GameState.Get())
+	{
+		NewRedScore = BoundGameState->RedTeamScore;
+		NewBlueScore = BoundGameState->BlueTeamScore;
+	}
+
+	if (!bHasValues || NewRedScore != RedScore || NewBlueScore != BlueScore)
+	{
+		RedScore = NewRedScore;
+		BlueScore = NewBlueScore;
+		OnTeamScoresChanged.Broadcast(RedScore, BlueScore);
+	}
+
+	// player score
+	const int32 NewPlayerScore = PlayerState.IsValid() ? FMath::RoundToInt(PlayerState->GetScore()) : 0;
+
+	if (!bHasValues || NewPlayerScore != PlayerScore)
+	{
+		PlayerScore = NewPlayerScore;
+		OnPlayerScoreChanged.Broadcast(PlayerScore);
+	}
+
+	// match state
+	const bool bNewWaitingToStart = GameState.IsValid() && GameState->GetMatchState() == MatchState::WaitingToStart;
+
+	if (!bHasValues || bNewWaitingToStart != bWaitingToStart)
+	{
+		bWaitingToStart = bNewWaitingToStart;
+		OnWaitingToStartChanged.Broadcast(bWaitingToStart);
+	}
+
+	bHasValues = true;
+
+	// only run the countdown timer while the countdown is actually running
+	FTimerManager& TimerManager = GetPlayerWorld()->GetTimerManager();
+
+	if (bWaitingToStart && GameState->MatchStartServerTime > 0.0)
+	{
+		if (!TimerManager.IsTimerActive(CountdownTimer))
+		{
+			TimerManager.SetTimer(CountdownTimer, FTimerDelegate::CreateUObject(this, &UShooterHUDViewModel::UpdateCountdown), CountdownInterval, true);
+		}
+	}
+	else
+	{
+		TimerManager.ClearTimer(CountdownTimer);
+	}
+
+	UpdateCountdown();
+}
+
+void UShooterHUDViewModel::UpdateCountdown()
+{
+	const int32 NewCountdown = (bWaitingToStart && GameState.IsValid()) ? FMath::CeilToInt(GameState->GetWaitingToStartRemaining()) : 0;
+
+	if (NewCountdown != Countdown)
+	{
+		Countdown = NewCountdown;
+		OnCountdownChanged.Broadcast(Countdown);
+	}
+}
+
+UWorld* UShooterHUDViewModel::GetPlayerWorld() const
+{
+	return PlayerController.IsValid() ? PlayerController->GetWorld() : nullptr;
+}
@@ -0,0 +1,97 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "ShooterHUDViewModel.generated.h"
+
+class APlayerController;
+class AShooterGameState;
+class AShooterPlayerState;
+class AShooterArena;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnShooterHUDTeamScoresChanged, int32 /*RedScore*/, int32 /*BlueScore*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnShooterHUDValueChanged, int32);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnShooterHUDWaitingChanged, bool);
+
+/**
+ *  Holds the values shown on the HUD and tells the widget only when one of them changes
+ *  Fed by replication notifies from the game state, player state and the player's arena, so the widget doesn't need to tick
+ */
+UCLASS()
+class MULTICLIENT_API UShooterHUDViewModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Called when the team scores change */
+	FOnShooterHUDTeamScoresChanged OnTeamScoresChanged;
+
+	/** Called when the local player's score changes */
+	FOnShooterHUDValueChanged OnPlayerScoreChanged;
+
+	/** Called when the match enters or leaves the waiting to start state */
+	FOnShooterHUDWaitingChanged OnWaitingToStartChanged;
+
+	/** Called when the whole seconds left before the match starts change */
+	FOnShooterHUDValueChanged OnCountdownChanged;
+
+	/** Binds to the player's game state, player state and arena, and pushes the current values */
+	void Initialize(APlayerController* InPlayerController);
+
+	/** Unbinds from everything */
+	void Deinitialize();
+
+	int32 GetRedScore() const { return RedScore; }
+	int32 GetBlueScore() const { return BlueScore; }
+	int32 GetPlayerScore() const { return PlayerScore; }
+	bool IsWaitingToStart() const { return bWaitingToStart; }
+	int32 GetCountdown() const { return Countdown; }
+
+private:
+
+	/** Seconds between bind attempts while the game state or player state haven't replicated yet */
+	static constexpr float BindRetryInterval = 0.25f;
+
+	/** Seconds between countdown updates while the match is about to start */
+	static constexpr float CountdownInterval = 0.1f;
+
+	TWeakObjectPtr<APlayerController> PlayerController;
+	TWeakObjectPtr<AShooterGameState> GameState;
+	TWeakObjectPtr<AShooterPlayerState> PlayerState;
+	TWeakObjectPtr<AShooterArena> Arena;
+
+	/** Current values */
+	int32 RedScore = INDEX_NONE;
+	int32 BlueScore = INDEX_NONE;
+	int32 PlayerScore = INDEX_NONE;
+	bool bWaitingToStart = false;
+	int32 Countdown = INDEX_NONE;
+
+	/** Set once the first values have been pushed, so the widget gets a full update */
+	bool bHasValues = false;
+
+	FTimerHandle BindRetryTimer;
+	FTimerHandle CountdownTimer;
+
+	FDelegateHandle GameStateHandle;
+	FDelegateHandle PlayerStateHandle;
+	FDelegateHandle ArenaHandle;
+
+	/** Binds to whatever has replicated so far, retrying until the game state and player state are there */
+	void TryBind();
+
+	/** Binds to the player's current arena, if it changed */
+	void BindArena();
+
+	/** Recomputes the values and notifies the ones that changed */
+	void Refresh();
+
+	/** Updates the countdown */
+	void UpdateCountdown();
+
+	/** Returns the world of the owning player */
+	UWorld* GetPlayerWorld() const;
+};
@@ -10,7 +10,7 @@
  *  Simple scoreboard UI for a first person shooter game
  */
 UCLASS(abstract)
-class MULTI_API UShooterUI : public UUserWidget
+class MULTICLIENT_API UShooterUI : public UUserWidget
 {
 	GENERATED_BODY()
 	
@@ -0,0 +1,48 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+
+#include "ShooterVitalsWidget.h"
+#include "SShooterVitals.h"
+#include "Styling/CoreStyle.h"
+
+#define LOCTEXT_NAMESPACE "ShooterVitalsWidget"
+
+UShooterVitalsWidget::UShooterVitalsWidget()
+{
+	Font = FCoreStyle::GetDefaultFontStyle("Bold", 24);
+}
+
+void UShooterVitalsWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyVitals.Reset();
+}
+
+#if WITH_EDITOR
+const FText UShooterVitalsWidget::GetPaletteCategory()
+{
+	return LOCTEXT("Shooter", "Shooter");
+}
+#endif
+
+TSharedRef<SWidget> UShooterVitalsWidget::RebuildWidget()
+{
+	MyVitals = SNew(SShooterVitals)
+		.PlayerController(GetOwningPlayer())
+		.BarBrush(&BarBrush)
+		.Font(Font)
+		.BarSize(BarSize)
+		.BackgroundColor(BackgroundColor)
+		.LifeColor(LifeColor)
+		.DrainColor(DrainColor)
+		.AmmoColor(AmmoColor)
+		.LowAmmoColor(LowAmmoColor)
+		.LowAmmoFraction(LowAmmoFraction)
+		.DrainSpeed(DrainSpeed)
+		.AmmoPulseTime(AmmoPulseTime);
+
+	return MyVitals.ToSharedRef();
+}
+
+#undef LOCTEXT_NAMESPACE
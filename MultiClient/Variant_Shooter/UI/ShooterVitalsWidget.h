@@ -0,0 +1,82 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "Styling/SlateBrush.h"
+#include "ShooterVitalsWidget.generated.h"
+
+class SShooterVitals;
+
+/**
+ *  UMG wrapper for the native ammo counter and health bar
+ *  Place it in the HUD widget to drive ammo and life without the Blueprint update events
+ */
+UCLASS()
+class MULTICLIENT_API UShooterVitalsWidget : public UWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UShooterVitalsWidget();
+
+	/** Releases the Slate widget */
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+
+	/** Brush for the bar background and fill */
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FSlateBrush BarBrush;
+
+	/** Font for the ammo counter */
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FSlateFontInfo Font;
+
+	/** Size of the health bar */
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FVector2D BarSize = FVector2D(300.0f, 16.0f);
+
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FLinearColor BackgroundColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.5f);
+
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FLinearColor LifeColor = FLinearColor::Green;
+
+	/** Color of the trail left behind by lost life */
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FLinearColor DrainColor = FLinearColor::Red;
+
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FLinearColor AmmoColor = FLinearColor::White;
+
+	UPROPERTY(EditAnywhere, Category="Appearance")
+	FLinearColor LowAmmoColor = FLinearColor::Red;
+
+	/** The ammo counter turns the low ammo color at or below this fraction of the magazine */
+	UPROPERTY(EditAnywhere, Category="Appearance", meta = (ClampMin = 0, ClampMax = 1))
+	float LowAmmoFraction = 0.25f;
+
+	/** Speed the lost life trail catches up, in life fraction per second */
+	UPROPERTY(EditAnywhere, Category="Animation", meta = (ClampMin = 0))
+	float DrainSpeed = 0.5f;
+
+	/** Time the ammo counter flashes after a shot */
+	UPROPERTY(EditAnywhere, Category="Animation", meta = (ClampMin = 0, Units = "s"))
+	float AmmoPulseTime = 0.15f;
+
+	/** Builds the Slate widget */
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+
+private:
+
+	/** Slate widget */
+	TSharedPtr<SShooterVitals> MyVitals;
+};
@@ -0,0 +1,18 @@
+// Copyright 2025 Daniel Acevedo (acevedod@usc.edu)
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+/**
+ * Dedicated server target. Only builds the gameplay module; the ClientOnly MultiClient module is left out.
+ */
+public class MultiServerTarget : TargetRules
+{
+	public MultiServerTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Server;
+		DefaultBuildSettings = BuildSettingsVersion.Latest;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+		ExtraModuleNames.Add("Multi");
+	}
+}